@@ -0,0 +1,187 @@
+/**
+ * @file DynamicArrayBenchmark.cpp
+ * @brief `DynamicArray` operations on non-trivial element types, against the
+ *        original implementation.
+ *
+ * `LegacyDynamicArray` below is the previous swap / whole-array-rotate /
+ * copy-only DynamicArray (its iterators replaced by pointers). Both are driven
+ * with `std::string` elements long enough to defeat the small-string buffer,
+ * so every copy allocates and every move is a pointer steal. Move-only
+ * `std::unique_ptr` elements, which the old class could not hold, are timed
+ * for the new class alone.
+ *
+ * Build and run:
+ * @code
+ * g++ -std=c++17 -O2 -Iinclude benchmarks/DynamicArrayBenchmark.cpp -o dynamic_array_bench && ./dynamic_array_bench
+ * @endcode
+ */
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "DynamicArray.h"
+
+namespace {
+
+constexpr size_t kCapacity = 200;
+constexpr int kRepeats = 2000;
+
+volatile size_t g_sink;
+
+//==============================================================//
+/// ORIGINAL IMPLEMENTATION
+//==============================================================//
+
+template <typename DataType, uint8_t MaxCount>
+class LegacyDynamicArray
+{
+public:
+    LegacyDynamicArray() : data(), count(0) {}
+
+    LegacyDynamicArray(const LegacyDynamicArray& other) noexcept :
+        data(),
+        count(other.count)
+    {
+        std::copy(other.data.begin(), other.data.begin() + count, data.begin());
+    }
+
+    bool Append(const DataType& item) {
+        if (count < MaxCount) {
+            data[count++] = item;
+            return true;
+        }
+        return false;
+    }
+
+    bool Remove(std::function<bool(const DataType&)>& condition) {
+        auto it = std::find_if(begin(), end(), condition);
+        if (it != end()) {
+            std::swap(*it, data[--count]);
+            return true;
+        }
+        return false;
+    }
+
+    bool Insert(size_t index, const DataType& item) {
+        if (index <= count && count < MaxCount) {
+            std::rotate(data.begin() + index, data.begin() + count, data.end());
+            data[index] = item;
+            ++count;
+            return true;
+        }
+        return false;
+    }
+
+    DataType* begin() { return data.data(); }
+    DataType* end() { return data.data() + count; }
+    size_t size() const noexcept { return count; }
+
+private:
+    std::array<DataType, MaxCount> data;
+    uint8_t count;
+};
+
+//==============================================================//
+/// WORKLOADS
+//==============================================================//
+
+std::string Item(size_t i)
+{
+    return "element number " + std::to_string(i) + " with a heap-allocated payload";
+}
+
+double NsSince(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+}
+
+/// Fills half the array, then inserts at the front until full.
+template <typename Array>
+double InsertFront()
+{
+    double ns = 0.0;
+    for (int r = 0; r < kRepeats; ++r) {
+        Array array;
+        for (size_t i = 0; i < kCapacity / 2U; ++i) { array.Append(Item(i)); }
+        const std::string item = Item(r);
+        const auto t0 = std::chrono::steady_clock::now();
+        for (size_t i = kCapacity / 2U; i < kCapacity; ++i) { array.Insert(0, item); }
+        ns += NsSince(t0);
+        g_sink = array.size();
+    }
+    return ns / (double(kRepeats) * double(kCapacity / 2U));
+}
+
+/// Removes every other element from a full array by predicate.
+template <typename Array>
+double RemoveHalf()
+{
+    double ns = 0.0;
+    for (int r = 0; r < kRepeats; ++r) {
+        Array array;
+        for (size_t i = 0; i < kCapacity; ++i) { array.Append(Item(i)); }
+        std::function<bool(const std::string&)> odd = [](const std::string& s) { return (s.size() & 1U) != 0U; };
+        const auto t0 = std::chrono::steady_clock::now();
+        while (array.Remove(odd)) {}
+        ns += NsSince(t0);
+        g_sink = array.size();
+    }
+    return ns / double(kRepeats);
+}
+
+/// Copy-constructs (Move = false) or move-constructs a full array.
+template <typename Array, bool Move>
+double Transfer()
+{
+    double ns = 0.0;
+    for (int r = 0; r < kRepeats; ++r) {
+        Array array;
+        for (size_t i = 0; i < kCapacity; ++i) { array.Append(Item(i)); }
+        const auto t0 = std::chrono::steady_clock::now();
+        Array other(Move ? static_cast<Array&&>(array) : array);
+        ns += NsSince(t0);
+        g_sink = other.size();
+    }
+    return ns / double(kRepeats);
+}
+
+/// Appends, inserts at the front and removes move-only elements.
+double UniquePtrChurn()
+{
+    using Array = DynamicArray<std::unique_ptr<size_t>, kCapacity>;
+    double ns = 0.0;
+    for (int r = 0; r < kRepeats; ++r) {
+        const auto t0 = std::chrono::steady_clock::now();
+        Array array;
+        for (size_t i = 0; i < kCapacity / 2U; ++i) { array.Append(std::make_unique<size_t>(i)); }
+        for (size_t i = kCapacity / 2U; i < kCapacity; ++i) { array.Insert(0, std::make_unique<size_t>(i)); }
+        while (array.Remove([](const std::unique_ptr<size_t>& p) { return (*p & 1U) != 0U; })) {}
+        Array moved(std::move(array));
+        ns += NsSince(t0);
+        g_sink = moved.size();
+    }
+    return ns / double(kRepeats);
+}
+
+} // namespace
+
+int main()
+{
+    using Current = DynamicArray<std::string, kCapacity>;
+    using Legacy = LegacyDynamicArray<std::string, kCapacity>;
+
+    std::printf("%-34s %12s %12s\n", "std::string, capacity 200", "legacy", "current");
+    std::printf("%-34s %12.1f %12.1f\n", "Insert(0) into half-full (ns/op)", InsertFront<Legacy>(), InsertFront<Current>());
+    std::printf("%-34s %12.1f %12.1f\n", "Remove every other (ns/array)", RemoveHalf<Legacy>(), RemoveHalf<Current>());
+    std::printf("%-34s %12.1f %12.1f\n", "copy construct (ns/array)", Transfer<Legacy, false>(), Transfer<Current, false>());
+    std::printf("%-34s %12.1f %12.1f\n", "move construct (ns/array)", Transfer<Legacy, true>(), Transfer<Current, true>());
+    std::printf("%-34s %12s %12.1f\n", "unique_ptr churn (ns/array)", "n/a", UniquePtrChurn());
+    return 0;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file NumericTextBenchmark.cpp
+ * @brief Throughput of NumericText.h against the C library conversions.
+ *
+ * Pre-generates one set of texts per workload (short decimals as found in
+ * configuration and CSV files, full 17-digit doubles, 9-digit floats and
+ * 32-bit integers), then times `ParseFloat` / `ParseInteger` against
+ * `strtod` / `strtof` / `strtol` and `FormatFloat` / `FormatInteger`
+ * against `snprintf` over the same inputs, printing ns per conversion.
+ *
+ * Build and run:
+ * @code
+ * g++ -std=c++17 -O2 -Iinclude benchmarks/NumericTextBenchmark.cpp -o numeric_text_bench && ./numeric_text_bench
+ * @endcode
+ */
+
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "NumericText.h"
+
+namespace {
+
+constexpr size_t kInputs = 20000;
+constexpr int kRepeats = 20;
+
+volatile double g_sink;
+
+double NsSince(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+}
+
+/// Best-of-kRepeats ns per input for `convert(i)` over every input index.
+template <typename Convert>
+double TimePerItem(size_t count, Convert convert)
+{
+    double best = 1e30;
+    for (int r = 0; r < kRepeats; ++r) {
+        const auto t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < count; ++i) { convert(i); }
+        const double ns = NsSince(t0) / double(count);
+        best = ns < best ? ns : best;
+    }
+    return best;
+}
+
+std::vector<std::string> Texts(const char* format, const std::vector<double>& values)
+{
+    std::vector<std::string> texts;
+    char buffer[64];
+    for (double v : values) {
+        std::snprintf(buffer, sizeof(buffer), format, v);
+        texts.emplace_back(buffer);
+    }
+    return texts;
+}
+
+void Row(const char* name, double ours, double theirs)
+{
+    std::printf("%-30s %10.1f %10.1f %8.2fx\n", name, ours, theirs, theirs / ours);
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937_64 rng(1234);
+    std::uniform_real_distribution<double> gain(-1000.0, 1000.0);
+    std::vector<double> shortValues, fullValues;
+    std::vector<int32_t> integers;
+    for (size_t i = 0; i < kInputs; ++i) {
+        shortValues.push_back(gain(rng));
+        uint64_t bits = rng();
+        double v = 0.0;
+        std::memcpy(&v, &bits, sizeof(v));
+        fullValues.push_back(std::isfinite(v) ? v : 1.0);
+        integers.push_back(static_cast<int32_t>(rng()));
+    }
+    const std::vector<std::string> shortTexts = Texts("%.3f", shortValues);
+    const std::vector<std::string> fullTexts = Texts("%.17g", fullValues);
+    const std::vector<std::string> floatTexts = Texts("%.9g", shortValues);
+    std::vector<std::string> integerTexts;
+    for (int32_t v : integers) { integerTexts.push_back(std::to_string(v)); }
+
+    std::printf("%-30s %10s %10s %9s\n", "ns per conversion", "hf_utils", "libc", "speed-up");
+
+    auto parseDouble = [](const std::vector<std::string>& texts) {
+        return TimePerItem(texts.size(), [&texts](size_t i) {
+            double v = 0.0;
+            hf_utils::ParseFloat(texts[i].data(), texts[i].data() + texts[i].size(), v);
+            g_sink = v;
+        });
+    };
+    auto strtodAll = [](const std::vector<std::string>& texts) {
+        return TimePerItem(texts.size(), [&texts](size_t i) { g_sink = std::strtod(texts[i].c_str(), nullptr); });
+    };
+    Row("parse double, 3 decimals", parseDouble(shortTexts), strtodAll(shortTexts));
+    Row("parse double, 17 digits", parseDouble(fullTexts), strtodAll(fullTexts));
+
+    const double parseFloat = TimePerItem(floatTexts.size(), [&floatTexts](size_t i) {
+        float v = 0.0f;
+        hf_utils::ParseFloat(floatTexts[i].data(), floatTexts[i].data() + floatTexts[i].size(), v);
+        g_sink = v;
+    });
+    const double strtofAll = TimePerItem(floatTexts.size(), [&floatTexts](size_t i) {
+        g_sink = std::strtof(floatTexts[i].c_str(), nullptr);
+    });
+    Row("parse float, 9 digits", parseFloat, strtofAll);
+
+    const double parseInt = TimePerItem(integerTexts.size(), [&integerTexts](size_t i) {
+        int32_t v = 0;
+        hf_utils::ParseInteger(integerTexts[i].data(), integerTexts[i].data() + integerTexts[i].size(), v);
+        g_sink = v;
+    });
+    const double strtolAll = TimePerItem(integerTexts.size(), [&integerTexts](size_t i) {
+        g_sink = double(std::strtol(integerTexts[i].c_str(), nullptr, 10));
+    });
+    Row("parse int32", parseInt, strtolAll);
+
+    char buffer[64];
+    auto formatDouble = [&buffer](const std::vector<double>& values, int digits) {
+        return TimePerItem(values.size(), [&](size_t i) {
+            g_sink = double(hf_utils::FormatFloat(buffer, buffer + sizeof(buffer), values[i], digits).ptr - buffer);
+        });
+    };
+    auto snprintfAll = [&buffer](const std::vector<double>& values, int digits) {
+        return TimePerItem(values.size(), [&](size_t i) {
+            g_sink = std::snprintf(buffer, sizeof(buffer), "%.*g", digits, values[i]);
+        });
+    };
+    Row("format double, 6 digits", formatDouble(shortValues, 6), snprintfAll(shortValues, 6));
+    Row("format double, 17 digits", formatDouble(fullValues, 17), snprintfAll(fullValues, 17));
+
+    const double formatInt = TimePerItem(integers.size(), [&](size_t i) {
+        g_sink = double(hf_utils::FormatInteger(buffer, buffer + sizeof(buffer), integers[i]).ptr - buffer);
+    });
+    const double snprintfInt = TimePerItem(integers.size(), [&](size_t i) {
+        g_sink = std::snprintf(buffer, sizeof(buffer), "%" PRId32, integers[i]);
+    });
+    Row("format int32", formatInt, snprintfInt);
+    return 0;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file StringViewUtilsBenchmark.cpp
+ * @brief StringViewUtils.h helpers against the allocating Utility.h string
+ *        functions on the same inputs.
+ *
+ * The input is a block of CSV-like lines: 16 fields each, padded with spaces
+ * and tabs and written in mixed case, as found in configuration and log
+ * files. Each row times one operation over every line (or field):
+ * - split: `StringSplit()` vs iterating `StringSplitView()`;
+ * - trim: `StringTrim()` vs `StringTrimView()` on every field;
+ * - lower: `StringToLower()` vs copying into a reused buffer and folding it
+ *   with `StringToLowerInPlace()`;
+ * - split + trim + lower: the three combined, as a parser would use them.
+ *
+ * Build and run (Utility.cpp provides the legacy functions):
+ * @code
+ * g++ -std=c++17 -O2 -pthread -Iinclude benchmarks/StringViewUtilsBenchmark.cpp src/Utility.cpp -o string_view_bench && ./string_view_bench
+ * @endcode
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "StringViewUtils.h"
+#include "Utility.h"
+
+namespace {
+
+constexpr size_t kLines = 2000;
+constexpr size_t kFields = 16;
+constexpr int kRepeats = 20;
+
+volatile size_t g_sink;
+
+double NsSince(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+}
+
+/// Best-of-kRepeats ns per line for `run(line)` over every line.
+template <typename Run>
+double TimePerLine(const std::vector<std::string>& lines, Run run)
+{
+    double best = 1e30;
+    for (int r = 0; r < kRepeats; ++r) {
+        size_t sum = 0;
+        const auto t0 = std::chrono::steady_clock::now();
+        for (const std::string& line : lines) { sum += run(line); }
+        const double ns = NsSince(t0) / double(lines.size());
+        g_sink = sum;
+        best = ns < best ? ns : best;
+    }
+    return best;
+}
+
+std::vector<std::string> MakeLines()
+{
+    static const char* const kWords[] = {"Temperature", "OK", "pressure_HIGH", "42.5", "Valve-3",
+                                         "DISABLED", "n/a", "FlowRate", "0x1F", "Sensor Bank B"};
+    static const char* const kPads[] = {"", " ", "  ", "\t", " \t "};
+    std::mt19937 rng(1234);
+    std::vector<std::string> lines;
+    for (size_t i = 0; i < kLines; ++i) {
+        std::string line;
+        for (size_t f = 0; f < kFields; ++f) {
+            if (f != 0U) { line += ','; }
+            line += kPads[rng() % 5U];
+            line += kWords[rng() % 10U];
+            line += kPads[rng() % 5U];
+        }
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+void Row(const char* name, double legacy, double views)
+{
+    std::printf("%-28s %12.1f %12.1f %8.2fx\n", name, legacy, views, legacy / views);
+}
+
+} // namespace
+
+int main()
+{
+    const std::vector<std::string> lines = MakeLines();
+    std::vector<std::string> fields;
+    for (const std::string& line : lines) {
+        for (std::string& field : StringSplit(line, ',')) { fields.push_back(std::move(field)); }
+    }
+
+    std::printf("%-28s %12s %12s %9s\n", "ns per line (16 fields)", "Utility.h", "views", "speed-up");
+
+    Row("split",
+        TimePerLine(lines, [](const std::string& line) { return StringSplit(line, ',').size(); }),
+        TimePerLine(lines, [](const std::string& line) {
+            size_t count = 0;
+            for (std::string_view token : hf_utils::StringSplitView(line, ',')) { count += token.empty() ? 0U : 1U; }
+            return count;
+        }));
+
+    /// Trim and lower run per field; report them per line of kFields fields as well
+    auto perLine = [](double nsPerField) { return nsPerField * double(kFields); };
+    Row("trim",
+        perLine(TimePerLine(fields, [](const std::string& field) { return StringTrim(field).size(); })),
+        perLine(TimePerLine(fields, [](const std::string& field) { return hf_utils::StringTrimView(field).size(); })));
+
+    std::string buffer;
+    Row("lower",
+        perLine(TimePerLine(fields, [](const std::string& field) { return StringToLower(field).size(); })),
+        perLine(TimePerLine(fields, [&buffer](const std::string& field) {
+            buffer.assign(field);
+            hf_utils::StringToLowerInPlace(buffer);
+            return size_t(buffer[0]);
+        })));
+
+    Row("split + trim + lower",
+        TimePerLine(lines, [](const std::string& line) {
+            size_t sum = 0;
+            for (const std::string& field : StringSplit(line, ',')) { sum += StringToLower(StringTrim(field)).size(); }
+            return sum;
+        }),
+        TimePerLine(lines, [&buffer](const std::string& line) {
+            size_t sum = 0;
+            for (std::string_view field : hf_utils::StringSplitView(line, ',')) {
+                buffer.assign(hf_utils::StringTrimView(field));
+                hf_utils::StringToLowerInPlace(buffer);
+                sum += buffer.size();
+            }
+            return sum;
+        }));
+    return 0;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file TraceBenchmark.cpp
+ * @brief Per-event cost of `TRACE_SCOPE` and `TRACE_COUNTER`.
+ *
+ * Emits events in bursts that fit the ring, draining it between bursts
+ * (outside the timed region), and prints the cost per event next to the cost
+ * of one bare `CycleClock::Now()`: a scope event reads the clock twice and a
+ * counter once, so the difference is the ring-write overhead.
+ *
+ * Build and run:
+ * @code
+ * g++ -std=c++17 -O2 -Iinclude benchmarks/TraceBenchmark.cpp -o trace_bench && ./trace_bench
+ * @endcode
+ */
+
+#define HF_UTILS_TRACE_ENABLED 1
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "Trace.h"
+
+namespace {
+
+constexpr size_t kBurst = hf_utils::kTraceRingCapacity / 2U;
+constexpr int kBursts = 2000;
+
+volatile uint64_t g_sink;
+
+double NsSince(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+}
+
+void Drain()
+{
+    hf_utils::TraceFlushChromeJson([](const char*, size_t) {});
+}
+
+} // namespace
+
+int main()
+{
+    double clockNs = 0.0;
+    double scopeNs = 0.0;
+    double counterNs = 0.0;
+
+    Drain();   // claim this thread's ring outside the timed loops
+    for (int b = 0; b < kBursts; ++b) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < kBurst; ++i) { g_sink = hf_utils::CycleClock::Now(); }
+        clockNs += NsSince(t0);
+
+        t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < kBurst; ++i) {
+            TRACE_SCOPE("scope");
+            g_sink = i;
+        }
+        scopeNs += NsSince(t0);
+        Drain();
+
+        t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < kBurst; ++i) { TRACE_COUNTER("counter", i); }
+        counterNs += NsSince(t0);
+        Drain();
+    }
+
+    const double events = double(kBurst) * double(kBursts);
+    std::printf("CycleClock::Now()  %6.1f ns\n", clockNs / events);
+    std::printf("TRACE_SCOPE        %6.1f ns/event (%.1f ns beyond two clock reads)\n",
+                scopeNs / events, (scopeNs - 2.0 * clockNs) / events);
+    std::printf("TRACE_COUNTER      %6.1f ns/event (%.1f ns beyond one clock read)\n",
+                counterNs / events, (counterNs - clockNs) / events);
+    return 0;
+}
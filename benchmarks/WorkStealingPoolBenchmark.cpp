@@ -0,0 +1,121 @@
+/**
+ * @file WorkStealingPoolBenchmark.cpp
+ * @brief Scaling of `WorkStealingPool` from one worker to every core.
+ *
+ * Runs the same batch (uniform items plus a recursive `Spawn()` fan-out) at
+ * 1, 2, 4, ... up to `hardware_concurrency()` workers and prints wall time,
+ * speed-up over one worker, and the CPU time the process burned, which shows
+ * whether idle workers park instead of spinning.
+ *
+ * Build and run (an optional argument overrides the core count):
+ * @code
+ * g++ -std=c++17 -O2 -pthread -Iinclude benchmarks/WorkStealingPoolBenchmark.cpp -o wsp_bench && ./wsp_bench
+ * @endcode
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <thread>
+
+#include "WorkStealingPool.h"
+
+namespace {
+
+constexpr size_t kMaxWorkers = 64;
+constexpr uint32_t kItems = 4096;
+constexpr uint32_t kSpawnDepth = 10;   // fan-out tree of 2^10 leaves per root
+constexpr int kRepeats = 5;
+
+using Pool = hf_utils::WorkStealingPool<kMaxWorkers, 4096>;
+
+struct Batch {
+    Pool* pool;
+    std::atomic<uint64_t> checksum{0};
+};
+
+uint64_t Spin(uint32_t seed)
+{
+    uint64_t x = seed * 0x9E3779B97F4A7C15ULL + 1U;
+    for (int i = 0; i < 2000; ++i) { x ^= x << 13; x ^= x >> 7; x ^= x << 17; }
+    return x;
+}
+
+void UniformItem(void* ctx, uint32_t index)
+{
+    static_cast<Batch*>(ctx)->checksum.fetch_add(Spin(index), std::memory_order_relaxed);
+}
+
+/// Index encodes depth in the top byte; each node spawns two children until kSpawnDepth.
+void FanOutItem(void* ctx, uint32_t index)
+{
+    Batch* batch = static_cast<Batch*>(ctx);
+    const uint32_t depth = index >> 24;
+    if (depth < kSpawnDepth) {
+        const uint32_t child = ((depth + 1U) << 24) | ((index & 0xFFFFFFU) * 2U & 0xFFFFFFU);
+        batch->pool->Spawn(child);
+        batch->pool->Spawn(child | 1U);
+    }
+    batch->checksum.fetch_add(Spin(index), std::memory_order_relaxed);
+}
+
+double CpuSeconds()
+{
+    return double(std::clock()) / double(CLOCKS_PER_SEC);
+}
+
+template <typename Seed>
+double RunBest(Pool& pool, Pool::Handler handler, Seed seed, double& cpu)
+{
+    double best = 1e30;
+    cpu = 0.0;
+    for (int r = 0; r < kRepeats; ++r) {
+        Batch batch;
+        batch.pool = &pool;
+        seed(pool);
+        const double cpu0 = CpuSeconds();
+        const auto t0 = std::chrono::steady_clock::now();
+        pool.RunAndWait(handler, &batch);
+        const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        cpu += CpuSeconds() - cpu0;
+        best = wall < best ? wall : best;
+    }
+    cpu /= kRepeats;
+    return best;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    size_t cores = (argc > 1) ? size_t(std::strtoul(argv[1], nullptr, 10)) : std::thread::hardware_concurrency();
+    cores = cores == 0U ? 1U : (cores > kMaxWorkers ? kMaxWorkers : cores);
+
+    std::printf("%-8s %-10s %12s %8s %10s\n", "workers", "batch", "wall (ms)", "speedup", "cpu (ms)");
+    double baseUniform = 0.0;
+    double baseFanOut = 0.0;
+    for (size_t workers = 1; ; workers = (workers * 2U < cores) ? workers * 2U : cores) {
+        Pool pool(workers);
+        double cpu = 0.0;
+
+        // Uniform items, all seeded on worker 0 so the others must steal.
+        const double uniform = RunBest(pool, &UniformItem, [](Pool& p) {
+            for (uint32_t i = 0; i < kItems; ++i) { p.Enqueue(0, i); }
+        }, cpu);
+        baseUniform = workers == 1U ? uniform : baseUniform;
+        std::printf("%-8zu %-10s %12.2f %8.2f %10.2f\n", workers, "uniform", uniform * 1e3, baseUniform / uniform, cpu * 1e3);
+
+        // A few roots that fan out through Spawn(): most workers start idle.
+        const double fanOut = RunBest(pool, &FanOutItem, [](Pool& p) {
+            for (uint32_t i = 0; i < 4U; ++i) { p.Enqueue(0, i); }
+        }, cpu);
+        baseFanOut = workers == 1U ? fanOut : baseFanOut;
+        std::printf("%-8zu %-10s %12.2f %8.2f %10.2f\n", workers, "fan-out", fanOut * 1e3, baseFanOut / fanOut, cpu * 1e3);
+
+        if (workers >= cores) { break; }
+    }
+    return 0;
+}
@@ -27,6 +27,8 @@
  * }
  * \endcode
  *
+ * @see hf_utils::RateLimitedAction (RateLimiter.h) to cap the run *rate*
+ *      (token bucket / sliding window) instead of the total run count.
  */
 class ActionRunLimiter
 {
@@ -2,6 +2,12 @@
  * @file ActionTimer.h
  * @brief Utility for measuring elapsed time of an action.
  *
+ * `ActionTimer` measures in milliseconds via `GetElapsedTimeMsec()`.
+ * `hf_utils::PrecisionActionTimer` measures in nanoseconds via
+ * `hf_utils::CycleClock`, and `hf_utils::ScopedTimer` records the lifetime
+ * of a scope into any sink with `Record(uint64_t ns)` (e.g. a
+ * `hf_utils::LatencyHistogram`).
+ *
  * @todo Add @copyright line once project copyright wording is finalised.
  */
 
@@ -9,6 +15,7 @@
 #define HF_UTILS_GENERAL_ACTIONTIMER_H_
 
 #include <cstdint>
+#include "HighResolutionClock.h"
 #include "Utility.h"
 
 /**
@@ -74,4 +81,103 @@ private:
     bool running_;       ///< Indicates whether the timer is currently running.
 };
 
+namespace hf_utils {
+
+/**
+ * @brief Nanosecond-resolution counterpart of `ActionTimer`.
+ *
+ * Timestamps are raw `CycleClock` ticks (TSC / generic timer), so `Start()`
+ * and `Stop()` cost a handful of cycles; conversion to ns happens only when
+ * a duration is read.
+ *
+ * \code{.cpp}
+ * hf_utils::PrecisionActionTimer timer;
+ * timer.Start();
+ * PackTelemetry();
+ * timer.Stop();
+ * uint64_t ns = timer.GetDurationNs();
+ * \endcode
+ */
+class PrecisionActionTimer {
+public:
+    /**
+     * @brief Starts the timer.
+     */
+    void Start() noexcept {
+        startTicks_ = CycleClock::Now();
+        running_ = true;
+    }
+
+    /**
+     * @brief Stops the timer.
+     */
+    void Stop() noexcept {
+        if (running_) {
+            endTicks_ = CycleClock::Now();
+            running_ = false;
+        }
+    }
+
+    /**
+     * @brief Gets the duration in raw clock ticks.
+     *
+     * @return Ticks since `Start()` while running, else between `Start()` and `Stop()`.
+     */
+    uint64_t GetDurationTicks() const noexcept {
+        return (running_ ? CycleClock::Now() : endTicks_) - startTicks_;
+    }
+
+    /**
+     * @brief Gets the duration of the action.
+     *
+     * @return The duration in nanoseconds.
+     */
+    uint64_t GetDurationNs() const noexcept {
+        return CycleClock::TicksToNs(GetDurationTicks());
+    }
+
+private:
+    uint64_t startTicks_{0}; ///< Tick count at `Start()`.
+    uint64_t endTicks_{0};   ///< Tick count at `Stop()`.
+    bool running_{false};    ///< Indicates whether the timer is currently running.
+};
+
+/**
+ * @brief RAII timer that records its lifetime in ns into a sink.
+ *
+ * \code{.cpp}
+ * hf_utils::LatencyHistogram<> controlLoopNs;
+ * void ControlLoop() {
+ *     hf_utils::ScopedTimer<hf_utils::LatencyHistogram<>> t(controlLoopNs);
+ *     // ...
+ * }
+ * \endcode
+ *
+ * @tparam Sink Any type with `Record(uint64_t ns)`.
+ */
+template <typename Sink>
+class ScopedTimer {
+public:
+    /**
+     * @param sink Receives the elapsed ns on destruction; must outlive the timer.
+     */
+    explicit ScopedTimer(Sink& sink) noexcept
+        : sink_(sink)
+        , startTicks_(CycleClock::Now())
+    { }
+
+    ~ScopedTimer() {
+        sink_.Record(CycleClock::TicksToNs(CycleClock::Now() - startTicks_));
+    }
+
+    ScopedTimer(const ScopedTimer&)            = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Sink&    sink_;       ///< Destination of the measurement.
+    uint64_t startTicks_; ///< Tick count at construction.
+};
+
+} // namespace hf_utils
+
 #endif /* HF_UTILS_GENERAL_ACTIONTIMER_H_ */
@@ -0,0 +1,165 @@
+/**
+ * @file AtomicEnumeratedSetStatus.h
+ * @brief Lock-free `EnumeratedSetStatus` for status reported from several tasks.
+ *
+ * Same interface as `EnumeratedSetStatus`, backed by `AtomicMultibitSet`, so
+ * several tasks can raise or clear statuses without a mutex. Telemetry can
+ * poll `Sequence()` and publish only the entries in words changed since the
+ * previous `ConsumeChanges()` call.
+ *
+ * ### Threading and allocation
+ * - No allocation. All functions except `ConsumeChanges()` may be called from
+ *   any number of threads; one publisher at a time should call
+ *   `ConsumeChanges()`.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_ATOMICENUMERATEDSETSTATUS_H_
+#define HF_UTILS_GENERAL_ATOMICENUMERATEDSETSTATUS_H_
+
+#include <cstdint>
+
+#include "AtomicMultibitSet.h"
+#include "Utility.h"
+
+namespace hf_utils {
+
+/**
+ * @brief Enumeration-indexed status set with lock-free updates and change tracking.
+ *
+ * @tparam EnumerationType Enumeration used as the index.
+ * @tparam StatusType      Enumeration stored per entry.
+ * @tparam BitsPerStatus   Bits per status entry, 1..8.
+ * @tparam EntryCount      Number of entries.
+ */
+template <typename EnumerationType, typename StatusType, uint8_t BitsPerStatus, uint16_t EntryCount>
+class AtomicEnumeratedSetStatus {
+public:
+    using Collection = AtomicMultibitSet<BitsPerStatus, EntryCount>;
+
+    /**
+     * @param defaultValue            Status of every entry after construction and `Erase()`.
+     * @param enumToStringConverter   Optional EnumerationType to string function.
+     * @param statusToStringConverter Optional StatusType to string function.
+     */
+    explicit AtomicEnumeratedSetStatus(StatusType defaultValue,
+                                       const char* (*enumToStringConverter)(EnumerationType) = nullptr,
+                                       const char* (*statusToStringConverter)(StatusType) = nullptr) noexcept
+        : enumToString_(enumToStringConverter),
+          statusToString_(statusToStringConverter),
+          collection_(std::to_underlying(defaultValue))
+    {}
+
+    AtomicEnumeratedSetStatus(const AtomicEnumeratedSetStatus&)            = delete;
+    AtomicEnumeratedSetStatus& operator=(const AtomicEnumeratedSetStatus&) = delete;
+
+    /// @return Number of entries.
+    static constexpr uint16_t size() noexcept { return EntryCount; }
+
+    /// @brief Set every entry to the default status.
+    void Erase() noexcept { collection_.erase(); }
+
+    /**
+     * @brief Set the status of one entry.
+     * @return True if the stored status changed.
+     */
+    bool Set(EnumerationType enumeration, StatusType status) noexcept
+    {
+        return collection_.set(uint16_t(std::to_underlying(enumeration)), uint8_t(std::to_underlying(status)));
+    }
+
+    /**
+     * @brief Set the status of one entry only if it currently holds `expected`
+     *        (e.g. raise a fault only if it has not been marked ignored).
+     * @return True if the swap happened.
+     */
+    bool CompareAndSet(EnumerationType enumeration, StatusType expected, StatusType desired) noexcept
+    {
+        return collection_.compare_and_set(uint16_t(std::to_underlying(enumeration)),
+                                           uint8_t(std::to_underlying(expected)),
+                                           uint8_t(std::to_underlying(desired)));
+    }
+
+    /// @brief Set every entry to the same status (one store per word).
+    void SetAll(StatusType status) noexcept { collection_.fill(uint8_t(std::to_underlying(status))); }
+
+    /// @return Status of the entry (the default status if out of range).
+    StatusType Get(EnumerationType enumeration) const noexcept
+    {
+        return StatusType(collection_.get(uint16_t(std::to_underlying(enumeration))));
+    }
+
+    /// @return True if any entry has `status`.
+    bool IsAny(StatusType status) const noexcept { return collection_.any(uint8_t(std::to_underlying(status))); }
+
+    /// @return Number of entries with `status`.
+    uint16_t CountStatus(StatusType status) const noexcept
+    {
+        return collection_.count(uint8_t(std::to_underlying(status)));
+    }
+
+    /// @brief Calls `callback(enumeration)` for every entry with `status`, in index order.
+    template <typename Callback>
+    void ForEachWithStatus(StatusType status, Callback&& callback) const
+    {
+        collection_.for_each_match(uint8_t(std::to_underlying(status)),
+                                   [&callback](uint16_t index) { callback(EnumerationType(index)); });
+    }
+
+    /// @return True if the entry has `status`.
+    bool IsStatus(EnumerationType enumeration, StatusType status) const noexcept
+    {
+        return collection_.get(uint16_t(std::to_underlying(enumeration))) == std::to_underlying(status);
+    }
+
+    /// @return True if the entry does not have `status`.
+    bool IsNotStatus(EnumerationType enumeration, StatusType status) const noexcept
+    {
+        return !IsStatus(enumeration, status);
+    }
+
+    /// @return Number of changes since construction (wraps); unchanged means nothing to publish.
+    uint32_t Sequence() const noexcept { return collection_.Sequence(); }
+
+    /**
+     * @brief Visit every entry in a storage word changed since the previous call.
+     *
+     * @param callback Callable `callback(EnumerationType, StatusType)`; may also
+     *                 report unchanged neighbours that share a changed word.
+     * @return Number of entries visited.
+     */
+    template <typename Callback>
+    uint16_t ConsumeChanges(Callback&& callback)
+    {
+        uint16_t visited = 0;
+        collection_.ConsumeChanges([&](uint16_t wordIndex, typename Collection::Word value) {
+            const uint16_t first = uint16_t(wordIndex * Collection::EntriesPerWord);
+            for (uint16_t i = 0; i < Collection::EntriesPerWord && first + i < EntryCount; ++i) {
+                callback(EnumerationType(first + i),
+                         StatusType(uint8_t((value >> (i * BitsPerStatus)) & Collection::EntryMask)));
+                ++visited;
+            }
+        });
+        return visited;
+    }
+
+    const char* ToStatusString(StatusType status) const noexcept
+    {
+        return statusToString_ ? statusToString_(status) : "Unknown";
+    }
+
+    const char* ToEnumerationString(EnumerationType enumeration) const noexcept
+    {
+        return enumToString_ ? enumToString_(enumeration) : "Unknown";
+    }
+
+private:
+    const char* (*enumToString_)(EnumerationType);
+    const char* (*statusToString_)(StatusType);
+    Collection collection_;
+};
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_ATOMICENUMERATEDSETSTATUS_H_ */
@@ -0,0 +1,285 @@
+/**
+ * @file AtomicMultibitSet.h
+ * @brief Lock-free packed array of small multi-bit entries with change tracking.
+ *
+ * Concurrent counterpart of `MultibitSet`. Entries are packed into
+ * `std::atomic<uint64_t>` words, `64 / BitsPerEntry` per word, and never
+ * straddle a word, so every update is a single-word compare-and-swap. The
+ * top `64 % BitsPerEntry` bits of each word and the bits past the last entry
+ * stay zero.
+ *
+ * Every update that actually changes a word
+ * - sets that word's bit in a dirty-word bitmap, and
+ * - increments a change sequence counter.
+ *
+ * A publisher calls `ConsumeChanges()` to visit only the words modified
+ * since its previous call (clearing their dirty bits first, so an update
+ * racing with the publish is reported again next time, never lost), and can
+ * skip the call entirely while `Sequence()` is unchanged.
+ *
+ * ### Threading and allocation
+ * - No allocation. Any number of threads may call the mutating and query
+ *   functions concurrently; queries see each word atomically (a multi-word
+ *   query is not one snapshot).
+ * - One publisher at a time should call `ConsumeChanges()`.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_ATOMICMULTIBITSET_H_
+#define HF_UTILS_GENERAL_ATOMICMULTIBITSET_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "BitOps.h"
+
+namespace hf_utils {
+
+/**
+ * @brief Lock-free `MultibitSet` with a dirty-word bitmap and change sequence.
+ *
+ * @tparam BitsPerEntry Bits per entry, 1..8.
+ * @tparam EntryCount   Number of entries.
+ */
+template <uint8_t BitsPerEntry, uint16_t EntryCount>
+class AtomicMultibitSet {
+    static_assert(BitsPerEntry >= 1 && BitsPerEntry <= 8, "BitsPerEntry must be in [1, 8] (values are uint8_t).");
+
+public:
+    using Word = uint64_t;
+
+    static constexpr uint16_t EntriesPerWord = 64U / BitsPerEntry;                                     ///< Entries per storage word
+    static constexpr uint16_t WordCount = uint16_t((EntryCount + EntriesPerWord - 1U) / EntriesPerWord); ///< Storage words
+    static constexpr Word EntryMask = (Word(1) << BitsPerEntry) - 1U;                                  ///< One entry at bit 0
+
+    /**
+     * @param initialValue Value of every entry after construction and `erase()`.
+     */
+    explicit AtomicMultibitSet(uint8_t initialValue = 0) noexcept
+        : initialValue_(uint8_t(initialValue & EntryMask))
+    {
+        for (uint16_t w = 0; w < WordCount; ++w) {
+            words_[w].store(PatternFor(w, initialValue_), std::memory_order_relaxed);
+        }
+        for (auto& d : dirty_) { d.store(0U, std::memory_order_relaxed); }
+    }
+
+    AtomicMultibitSet(const AtomicMultibitSet&)            = delete;
+    AtomicMultibitSet& operator=(const AtomicMultibitSet&) = delete;
+
+    /// @return Number of entries.
+    static constexpr uint16_t size() noexcept { return EntryCount; }
+
+    /**
+     * @brief Store `value` in entry `index`.
+     *
+     * @return True if the entry changed (out-of-range indices return false).
+     */
+    bool set(uint16_t index, uint8_t value) noexcept
+    {
+        if (index >= EntryCount) { return false; }
+        const uint16_t w = WordOf(index);
+        const unsigned shift = ShiftOf(index);
+        const Word field = (Word(value) & EntryMask) << shift;
+        const Word mask = EntryMask << shift;
+
+        Word old = words_[w].load(std::memory_order_relaxed);
+        Word desired;
+        do {
+            desired = (old & ~mask) | field;
+            if (desired == old) { return false; }
+        } while (!words_[w].compare_exchange_weak(old, desired, std::memory_order_acq_rel,
+                                                  std::memory_order_relaxed));
+        MarkDirty(w);
+        return true;
+    }
+
+    /**
+     * @brief Store `desired` in entry `index` only if it currently holds `expected`.
+     *
+     * @return True if the swap happened.
+     */
+    bool compare_and_set(uint16_t index, uint8_t expected, uint8_t desired) noexcept
+    {
+        if (index >= EntryCount) { return false; }
+        const uint16_t w = WordOf(index);
+        const unsigned shift = ShiftOf(index);
+        const Word mask = EntryMask << shift;
+        const Word expectedField = (Word(expected) & EntryMask) << shift;
+        const Word desiredField = (Word(desired) & EntryMask) << shift;
+
+        Word old = words_[w].load(std::memory_order_relaxed);
+        do {
+            if ((old & mask) != expectedField) { return false; }
+            if (expectedField == desiredField) { return true; }
+        } while (!words_[w].compare_exchange_weak(old, (old & ~mask) | desiredField,
+                                                  std::memory_order_acq_rel, std::memory_order_relaxed));
+        MarkDirty(w);
+        return true;
+    }
+
+    /**
+     * @brief Read entry `index` (the initial value if out of range).
+     */
+    uint8_t get(uint16_t index) const noexcept
+    {
+        if (index >= EntryCount) { return initialValue_; }
+        return uint8_t((words_[WordOf(index)].load(std::memory_order_acquire) >> ShiftOf(index)) & EntryMask);
+    }
+
+    /**
+     * @brief Store the same value in every entry (one store per word).
+     */
+    void fill(uint8_t value) noexcept
+    {
+        const uint8_t field = uint8_t(value & EntryMask);
+        for (uint16_t w = 0; w < WordCount; ++w) {
+            const Word pattern = PatternFor(w, field);
+            if (words_[w].exchange(pattern, std::memory_order_acq_rel) != pattern) {
+                MarkDirty(w);
+            }
+        }
+    }
+
+    /**
+     * @brief Reset every entry to the initial value.
+     */
+    void erase() noexcept { fill(initialValue_); }
+
+    /**
+     * @brief Returns true if any entry equals `value`.
+     */
+    bool any(uint8_t value) const noexcept
+    {
+        for (uint16_t w = 0; w < WordCount; ++w) {
+            if (MatchBits(w, uint8_t(value & EntryMask)) != 0U) { return true; }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Returns the number of entries equal to `value`.
+     */
+    uint16_t count(uint8_t value) const noexcept
+    {
+        uint16_t total = 0;
+        for (uint16_t w = 0; w < WordCount; ++w) {
+            total = uint16_t(total + PopCount(MatchBits(w, uint8_t(value & EntryMask))));
+        }
+        return total;
+    }
+
+    /**
+     * @brief Calls `fn(index)` for every entry equal to `value`, in index order.
+     */
+    template <typename Fn>
+    void for_each_match(uint8_t value, Fn&& fn) const
+    {
+        for (uint16_t w = 0; w < WordCount; ++w) {
+            Word bits = MatchBits(w, uint8_t(value & EntryMask));
+            while (bits != 0U) {
+                fn(uint16_t(w * EntriesPerWord + CountTrailingZeros(bits) / BitsPerEntry));
+                bits &= bits - 1U;
+            }
+        }
+    }
+
+    /**
+     * @brief Number of word changes since construction (wraps).
+     */
+    uint32_t Sequence() const noexcept { return sequence_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Visit every word modified since the previous call.
+     *
+     * Each dirty bit is cleared before its word is read, so an update that
+     * races with this call is reported by the next one.
+     *
+     * @param fn Callable `fn(uint16_t wordIndex, Word value)`; entry `i` of
+     *           the word is `(value >> (i * BitsPerEntry)) & EntryMask` and
+     *           has index `wordIndex * EntriesPerWord + i`.
+     * @return Number of words visited.
+     */
+    template <typename Fn>
+    uint16_t ConsumeChanges(Fn&& fn)
+    {
+        uint16_t visited = 0;
+        for (uint16_t d = 0; d < DirtyWords; ++d) {
+            Word pending = dirty_[d].exchange(0U, std::memory_order_acq_rel);
+            while (pending != 0U) {
+                const uint16_t w = uint16_t(d * 64U + CountTrailingZeros(pending));
+                fn(w, words_[w].load(std::memory_order_acquire));
+                pending &= pending - 1U;
+                ++visited;
+            }
+        }
+        return visited;
+    }
+
+    /**
+     * @brief Raw value of storage word `wordIndex` (for full snapshots).
+     */
+    Word LoadWord(uint16_t wordIndex) const noexcept { return words_[wordIndex].load(std::memory_order_acquire); }
+
+private:
+    static constexpr uint16_t DirtyWords = uint16_t((WordCount + 63U) / 64U);
+
+    static constexpr uint16_t WordOf(uint16_t index) noexcept { return uint16_t(index / EntriesPerWord); }
+    static constexpr unsigned ShiftOf(uint16_t index) noexcept { return unsigned(index % EntriesPerWord) * BitsPerEntry; }
+
+    /// Entries held by word `w` (the last word may be partial)
+    static constexpr uint16_t EntriesIn(uint16_t w) noexcept
+    {
+        return (w == WordCount - 1U && (EntryCount % EntriesPerWord) != 0U)
+                   ? uint16_t(EntryCount % EntriesPerWord) : EntriesPerWord;
+    }
+
+    /// Mask of the `entries` low fields
+    static constexpr Word FieldsMask(uint16_t entries) noexcept
+    {
+        return (unsigned(entries) * BitsPerEntry >= 64U) ? ~Word(0) : ((Word(1) << (entries * BitsPerEntry)) - 1U);
+    }
+
+    static constexpr Word Replicate(Word pattern) noexcept
+    {
+        Word result = 0;
+        for (uint16_t i = 0; i < EntriesPerWord; ++i) { result |= pattern << (i * BitsPerEntry); }
+        return result;
+    }
+
+    static constexpr Word EntryOnes = Replicate(1U);                             ///< Bit 0 of every entry
+    static constexpr Word LowEntryBits = Replicate(EntryMask >> 1);              ///< All but the top bit of every entry
+    static constexpr Word HighEntryBits = Replicate(Word(1) << (BitsPerEntry - 1)); ///< Top bit of every entry
+
+    static constexpr Word PatternFor(uint16_t w, uint8_t field) noexcept
+    {
+        return (Word(field) * EntryOnes) & FieldsMask(EntriesIn(w));
+    }
+
+    /**
+     * @brief Top bit of each entry of word `w` set iff that entry equals `field`
+     *        (same exact SWAR zero-field test as `MultibitSet`).
+     */
+    Word MatchBits(uint16_t w, uint8_t field) const noexcept
+    {
+        const Word x = words_[w].load(std::memory_order_acquire) ^ (Word(field) * EntryOnes);
+        return ~(((x & LowEntryBits) + LowEntryBits) | x | LowEntryBits) & HighEntryBits & FieldsMask(EntriesIn(w));
+    }
+
+    void MarkDirty(uint16_t w) noexcept
+    {
+        dirty_[w / 64U].fetch_or(Word(1) << (w % 64U), std::memory_order_release);
+        sequence_.fetch_add(1U, std::memory_order_release);
+    }
+
+    const uint8_t initialValue_;
+    std::array<std::atomic<Word>, WordCount> words_{};
+    std::array<std::atomic<Word>, DirtyWords> dirty_{};
+    std::atomic<uint32_t> sequence_{0};
+};
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_ATOMICMULTIBITSET_H_ */
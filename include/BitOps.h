@@ -0,0 +1,88 @@
+/**
+ * @file BitOps.h
+ * @brief Portable count-trailing-zeros / popcount / bit-scan helpers.
+ *
+ * C++17 has no `<bit>`, so these wrap the GCC / Clang builtins and fall back
+ * to plain loops on other compilers. Every helper is `constexpr` (the
+ * builtins fold in constant expressions) and `noexcept`.
+ *
+ * ### Threading and allocation
+ * - Pure functions; no state, no allocation.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_BITOPS_H_
+#define HF_UTILS_GENERAL_BITOPS_H_
+
+#include <cstdint>
+
+namespace hf_utils {
+
+/**
+ * @brief Index of the least-significant set bit.
+ * @param value Word to scan; must be non-zero.
+ * @return Bit index in `[0, 63]`. Undefined for `value == 0`.
+ */
+constexpr unsigned CountTrailingZeros(uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(value));
+#else
+    unsigned n = 0;
+    while ((value & 1U) == 0U) { value >>= 1; ++n; }
+    return n;
+#endif
+}
+
+/**
+ * @brief Index of the most-significant set bit.
+ * @param value Word to scan; must be non-zero.
+ * @return Bit index in `[0, 63]`. Undefined for `value == 0`.
+ */
+constexpr unsigned MostSignificantBit(uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 63U - static_cast<unsigned>(__builtin_clzll(value));
+#else
+    unsigned n = 0;
+    while (value >>= 1) { ++n; }
+    return n;
+#endif
+}
+
+/**
+ * @brief Number of set bits in `value`.
+ */
+constexpr unsigned PopCount(uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_popcountll(value));
+#else
+    unsigned n = 0;
+    while (value) { value &= value - 1U; ++n; }
+    return n;
+#endif
+}
+
+/**
+ * @brief Isolate the lowest set bit (`0` if none).
+ */
+constexpr uint64_t LowestSetBit(uint64_t value) noexcept
+{
+    return value & (~value + 1U);
+}
+
+/**
+ * @brief Smallest power of two that is `>= value` (`1` for `value == 0`).
+ */
+constexpr uint64_t NextPowerOfTwo(uint64_t value) noexcept
+{
+    uint64_t result = 1U;
+    while (result < value) { result <<= 1; }
+    return result;
+}
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_BITOPS_H_ */
@@ -0,0 +1,223 @@
+/**
+ * @file CurveLookupTable.h
+ * @brief Compile-time lookup tables generated from curve breakpoints or
+ *        linear segments.
+ *
+ * For curves fixed at build time, `MakeCurveLookupTable<Cells>()` resamples
+ * the curve on `Cells + 1` uniformly spaced points and stores, per cell, the
+ * slope and intercept of the chord between them. Built in a `constexpr`
+ * context the table lives in read-only data and needs no start-up code:
+ *
+ * @code
+ * constexpr hf_utils::CurvePoint kPoints[] = {{0.f, 0.f}, {10.f, 2.5f}, {40.f, 4.f}};
+ * static constexpr auto kTable = hf_utils::MakeCurveLookupTable<64>(kPoints);
+ * float y = kTable.Evaluate(x);   // one index computation + one multiply-add
+ * @endcode
+ *
+ * Accuracy: exact wherever every breakpoint lies on a cell edge (choose
+ * `Cells` so that the breakpoint spacing is a multiple of the cell width);
+ * otherwise the error is confined to the cells containing a breakpoint and
+ * bounded by the slope change there times the cell width.
+ *
+ * Segment lists follow `PiecewiseBoundedLinearCurve`'s linear search where
+ * segments overlap: the first segment containing x wins. Gaps differ: the
+ * table covers the whole span from the lowest xMin to the highest xMax and
+ * bridges a gap with the value of the nearest segment end, where
+ * `PiecewiseBoundedLinearCurve::CalculateY` returns false.
+ *
+ * ### Threading and allocation
+ * - No allocation; evaluation is const and re-entrant.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_CURVELOOKUPTABLE_H_
+#define HF_UTILS_GENERAL_CURVELOOKUPTABLE_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace hf_utils {
+
+/// One breakpoint of a piecewise linear curve.
+struct CurvePoint {
+    float x;
+    float y;
+};
+
+/// Literal-type counterpart of `BoundedLinearCurve` (y = slope * x + intercept on [xMin, xMax]).
+struct CurveSegment {
+    float slope;
+    float intercept;
+    float xMin;
+    float xMax;
+};
+
+/**
+ * @brief Dense uniform-cell table of (slope, intercept) pairs.
+ * @tparam Cells Number of cells across `[XMin(), XMax()]`.
+ */
+template <size_t Cells>
+class CurveLookupTable {
+    static_assert(Cells >= 1 && Cells <= (size_t(1) << 24), "Cells must be in [1, 2^24] (exact float cell index).");
+
+public:
+    struct Cell {
+        float slope;
+        float intercept;
+    };
+
+    constexpr CurveLookupTable() noexcept = default;
+
+    /**
+     * @brief Value at `x`; inputs outside the table range are clamped to it.
+     */
+    constexpr float Evaluate(float x) const noexcept
+    {
+        x = x < xMin_ ? xMin_ : (x > xMax_ ? xMax_ : x);
+        return At(x);
+    }
+
+    /**
+     * @brief Value at `x`, or false outside the table range.
+     *
+     * Unlike `PiecewiseBoundedLinearCurve::CalculateY`, an `x` inside the range but in a
+     * gap between source segments succeeds with the bridged value (see the file overview).
+     * @return False (y untouched) if `x` is outside [XMin(), XMax()].
+     */
+    constexpr bool CalculateY(float x, float& y) const noexcept
+    {
+        if (!(x >= xMin_ && x <= xMax_)) { return false; }
+        y = At(x);
+        return true;
+    }
+
+    constexpr float XMin() const noexcept { return xMin_; }
+    constexpr float XMax() const noexcept { return xMax_; }
+    static constexpr size_t CellCount() noexcept { return Cells; }
+    constexpr const Cell& CellAt(size_t index) const noexcept { return cells_[index]; }
+
+private:
+    template <size_t C, typename Sample>
+    friend constexpr CurveLookupTable<C> BuildCurveLookupTable(double xMin, double xMax, Sample sample) noexcept;
+
+    constexpr float At(float x) const noexcept
+    {
+        float position = x * scale_ + bias_;                          // (x - xMin) / cellWidth
+        position = position > 0.0f ? position : 0.0f;
+        position = position < float(Cells - 1U) ? position : float(Cells - 1U);
+        const size_t index = size_t(static_cast<int32_t>(position));
+        return cells_[index].slope * x + cells_[index].intercept;    // contracts to one FMA where available
+    }
+
+    float xMin_ = 0.0f;
+    float xMax_ = 0.0f;
+    float scale_ = 0.0f;
+    float bias_ = 0.0f;
+    std::array<Cell, Cells> cells_{};
+};
+
+//==============================================================//
+/// GENERATION
+//==============================================================//
+
+/**
+ * @brief Build a table over `[xMin, xMax]` from any `double sample(double x)`.
+ *
+ * Chords are computed in double and stored as float; usable in constant
+ * expressions when `sample` is.
+ */
+template <size_t Cells, typename Sample>
+constexpr CurveLookupTable<Cells> BuildCurveLookupTable(double xMin, double xMax, Sample sample) noexcept
+{
+    CurveLookupTable<Cells> table;
+    const double width = (xMax - xMin) / double(Cells);
+    table.xMin_ = float(xMin);
+    table.xMax_ = float(xMax);
+    table.scale_ = width > 0.0 ? float(1.0 / width) : 0.0f;
+    table.bias_ = width > 0.0 ? float(-xMin / width) : 0.0f;
+
+    double x0 = xMin;
+    double y0 = sample(x0);
+    for (size_t k = 0; k < Cells; ++k) {
+        const double x1 = (k + 1U == Cells) ? xMax : xMin + width * double(k + 1U);
+        const double y1 = sample(x1);
+        const double slope = (x1 > x0) ? (y1 - y0) / (x1 - x0) : 0.0;
+        table.cells_[k].slope = float(slope);
+        table.cells_[k].intercept = float(y0 - slope * x0);
+        x0 = x1;
+        y0 = y1;
+    }
+    return table;
+}
+
+namespace detail {
+
+/// Linear interpolation through ascending breakpoints, clamped at both ends.
+constexpr double InterpolateBreakpoints(const CurvePoint* points, size_t count, double x) noexcept
+{
+    if (x <= double(points[0].x)) { return points[0].y; }
+    for (size_t i = 1; i < count; ++i) {
+        if (x <= double(points[i].x)) {
+            const double x0 = points[i - 1U].x, y0 = points[i - 1U].y;
+            const double x1 = points[i].x, y1 = points[i].y;
+            return (x1 > x0) ? y0 + (y1 - y0) * (x - x0) / (x1 - x0) : y1;
+        }
+    }
+    return points[count - 1U].y;
+}
+
+/// First segment containing x, else the value at the nearest segment end.
+constexpr double EvaluateSegments(const CurveSegment* segments, size_t count, double x) noexcept
+{
+    double best = 0.0;
+    double bestDistance = -1.0;
+    for (size_t i = 0; i < count; ++i) {
+        const CurveSegment& s = segments[i];
+        if (x >= double(s.xMin) && x <= double(s.xMax)) { return double(s.slope) * x + double(s.intercept); }
+        const double end = x < double(s.xMin) ? double(s.xMin) : double(s.xMax);
+        const double distance = x < end ? end - x : x - end;
+        if (bestDistance < 0.0 || distance < bestDistance) {
+            bestDistance = distance;
+            best = double(s.slope) * end + double(s.intercept);
+        }
+    }
+    return best;
+}
+
+} // namespace detail
+
+/**
+ * @brief Table over the span of ascending breakpoints `points`.
+ */
+template <size_t Cells, size_t N>
+constexpr CurveLookupTable<Cells> MakeCurveLookupTable(const CurvePoint (&points)[N]) noexcept
+{
+    static_assert(N >= 2, "A curve needs at least two breakpoints.");
+    return BuildCurveLookupTable<Cells>(points[0].x, points[N - 1U].x,
+                                        [&points](double x) { return detail::InterpolateBreakpoints(points, N, x); });
+}
+
+/**
+ * @brief Table over the span of `segments` (from the lowest xMin to the highest xMax).
+ *
+ * Gaps between segments take the value of the nearest segment end.
+ */
+template <size_t Cells, size_t N>
+constexpr CurveLookupTable<Cells> MakeCurveLookupTable(const CurveSegment (&segments)[N]) noexcept
+{
+    static_assert(N >= 1, "A curve needs at least one segment.");
+    double xMin = segments[0].xMin;
+    double xMax = segments[0].xMax;
+    for (size_t i = 1; i < N; ++i) {
+        xMin = double(segments[i].xMin) < xMin ? double(segments[i].xMin) : xMin;
+        xMax = double(segments[i].xMax) > xMax ? double(segments[i].xMax) : xMax;
+    }
+    return BuildCurveLookupTable<Cells>(xMin, xMax,
+                                        [&segments](double x) { return detail::EvaluateSegments(segments, N, x); });
+}
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_CURVELOOKUPTABLE_H_ */
@@ -0,0 +1,217 @@
+/**
+ * @file DeltaEncoding.h
+ * @brief Dirty-entry bitmap and compact (index, value) run encoding for
+ *        publishing only the table entries that changed.
+ *
+ * Wire format: a sequence of runs, each
+ *
+ *     [u16 start, little endian][u16 count, little endian][count * ValueBytes]
+ *
+ * with runs in ascending index order and values laid out in index order.
+ * Two dirty runs separated by a clean gap are merged whenever resending the
+ * gap values is cheaper than a new run header, so a run may carry a few
+ * unchanged values.
+ *
+ * Used by `EnumArray` and `EnumeratedSetStatus` when their `TrackChanges`
+ * template argument is true. Both inherit the bitmap privately, so untracked
+ * tables get the empty `DirtyBitmap<0>` as an empty base: no storage, and
+ * every call compiles away.
+ *
+ * ### Threading and allocation
+ * - No allocation. Not thread-safe; the owning table's rules apply.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_DELTAENCODING_H_
+#define HF_UTILS_GENERAL_DELTAENCODING_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "BitOps.h"
+
+namespace hf_utils {
+
+/// Bytes of the `[start][count]` header in front of every run.
+constexpr size_t kDeltaRunHeaderBytes = 4;
+
+//==============================================================//
+/// DIRTY BITMAP
+//==============================================================//
+
+/**
+ * @brief One bit per table entry, set when the entry is modified.
+ * @tparam Bits Number of entries tracked.
+ */
+template <size_t Bits>
+class DirtyBitmap {
+public:
+    static constexpr bool Enabled = true;
+
+    void Mark(size_t index) noexcept
+    {
+        if (index < Bits) { words_[index / 64U] |= uint64_t(1) << (index % 64U); }
+    }
+
+    void MarkAll() noexcept
+    {
+        words_.fill(~uint64_t(0));
+        if ((Bits % 64U) != 0U) { words_[WordCount - 1U] = (uint64_t(1) << (Bits % 64U)) - 1U; }
+    }
+
+    void ClearAll() noexcept { words_.fill(0U); }
+
+    bool IsMarked(size_t index) const noexcept
+    {
+        return index < Bits && ((words_[index / 64U] >> (index % 64U)) & 1U) != 0U;
+    }
+
+    bool Any() const noexcept
+    {
+        for (uint64_t w : words_) {
+            if (w != 0U) { return true; }
+        }
+        return false;
+    }
+
+    /// @return Index of the first marked entry at or after `from`, or `Bits`.
+    size_t FindMarked(size_t from) const noexcept { return Find(from, 0U); }
+
+    /// @return Index of the first unmarked entry at or after `from`, or `Bits`.
+    size_t FindUnmarked(size_t from) const noexcept { return Find(from, ~uint64_t(0)); }
+
+    /// @brief Clear the marks of entries `[first, last)`.
+    void Clear(size_t first, size_t last) noexcept
+    {
+        for (size_t i = first; i < last && i < Bits; ++i) {
+            words_[i / 64U] &= ~(uint64_t(1) << (i % 64U));
+        }
+    }
+
+private:
+    static constexpr size_t WordCount = (Bits + 63U) / 64U;
+
+    size_t Find(size_t from, uint64_t invert) const noexcept
+    {
+        for (size_t w = from / 64U; w < WordCount; ++w) {
+            uint64_t bits = words_[w] ^ invert;
+            if (w == from / 64U) { bits &= ~uint64_t(0) << (from % 64U); }
+            if (bits != 0U) {
+                const size_t index = w * 64U + CountTrailingZeros(bits);
+                return index < Bits ? index : Bits;
+            }
+        }
+        return Bits;
+    }
+
+    std::array<uint64_t, WordCount> words_{};
+};
+
+/// Tracking disabled: no storage, every call is a no-op.
+template <>
+class DirtyBitmap<0> {
+public:
+    static constexpr bool Enabled = false;
+
+    void Mark(size_t) noexcept {}
+    void MarkAll() noexcept {}
+    void ClearAll() noexcept {}
+    bool IsMarked(size_t) const noexcept { return false; }
+    bool Any() const noexcept { return false; }
+};
+
+//==============================================================//
+/// RUN ENCODING
+//==============================================================//
+
+/**
+ * @brief Encode the marked entries of `dirty` as runs and clear the marks of
+ *        every entry emitted.
+ *
+ * If `capacity` runs out, the entries that did not fit stay marked and go
+ * out with the next call.
+ *
+ * @param dirty       Bitmap of modified entries.
+ * @param valueBytes  Encoded size of one value.
+ * @param out         Destination buffer.
+ * @param capacity    Size of `out` in bytes.
+ * @param writeValue  Callable `writeValue(size_t index, uint8_t* dst)` that
+ *                    writes exactly `valueBytes` bytes.
+ * @return Bytes written to `out` (0 when nothing is dirty).
+ */
+template <size_t Bits, typename WriteValue>
+size_t EncodeDeltaRuns(DirtyBitmap<Bits>& dirty, size_t valueBytes, uint8_t* out, size_t capacity,
+                       WriteValue&& writeValue) noexcept
+{
+    static_assert(Bits <= 0xFFFFU, "Run indices are encoded as uint16_t.");
+
+    // Resending a clean gap costs gap * valueBytes; a new run costs its header.
+    const size_t maxBridge = (kDeltaRunHeaderBytes - 1U) / valueBytes;
+    size_t written = 0;
+    size_t start = dirty.FindMarked(0);
+
+    while (start < Bits) {
+        size_t end = dirty.FindUnmarked(start);
+        for (;;) {
+            const size_t next = dirty.FindMarked(end);
+            if (next >= Bits || next - end > maxBridge) { break; }
+            end = dirty.FindUnmarked(next);
+        }
+
+        if (capacity - written < kDeltaRunHeaderBytes + valueBytes) { break; }
+        const size_t fit = (capacity - written - kDeltaRunHeaderBytes) / valueBytes;
+        const size_t count = (end - start) < fit ? (end - start) : fit;
+
+        uint8_t* header = out + written;
+        header[0] = uint8_t(start);
+        header[1] = uint8_t(start >> 8);
+        header[2] = uint8_t(count);
+        header[3] = uint8_t(count >> 8);
+        written += kDeltaRunHeaderBytes;
+        for (size_t i = start; i < start + count; ++i) {
+            writeValue(i, out + written);
+            written += valueBytes;
+        }
+        dirty.Clear(start, start + count);
+
+        if (start + count < end) { break; }   // buffer full mid-run
+        start = dirty.FindMarked(end);
+    }
+    return written;
+}
+
+/**
+ * @brief Decode runs produced by `EncodeDeltaRuns`.
+ *
+ * @param in          Encoded runs.
+ * @param length      Size of `in` in bytes.
+ * @param valueBytes  Encoded size of one value.
+ * @param entryCount  Number of entries in the destination table.
+ * @param readValue   Callable `readValue(size_t index, const uint8_t* src)`.
+ * @return False if the input is truncated or indexes past `entryCount`;
+ *         runs before the faulty one have already been applied.
+ */
+template <typename ReadValue>
+bool DecodeDeltaRuns(const uint8_t* in, size_t length, size_t valueBytes, size_t entryCount,
+                     ReadValue&& readValue) noexcept
+{
+    size_t pos = 0;
+    while (pos < length) {
+        if (length - pos < kDeltaRunHeaderBytes) { return false; }
+        const size_t start = size_t(in[pos]) | (size_t(in[pos + 1]) << 8);
+        const size_t count = size_t(in[pos + 2]) | (size_t(in[pos + 3]) << 8);
+        pos += kDeltaRunHeaderBytes;
+        if (start + count > entryCount || count * valueBytes > length - pos) { return false; }
+        for (size_t i = start; i < start + count; ++i) {
+            readValue(i, in + pos);
+            pos += valueBytes;
+        }
+    }
+    return true;
+}
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_DELTAENCODING_H_ */
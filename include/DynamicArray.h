@@ -17,11 +17,32 @@
 #include <algorithm>
 #include <iterator>
 #include <cstddef>
-#include <functional>
+#include <cstdint>
+#include <functional>    // no longer used here; kept because callers passing std::function to Remove() rely on it
+#include <limits>
+#include <type_traits>
+#include <utility>
 
-template <typename DataType, uint8_t MaxCount>
+/**
+ * @brief Smallest unsigned type able to hold the value `MaxCount`.
+ */
+template <size_t MaxCount>
+using DynamicArrayCountType =
+    std::conditional_t<MaxCount <= UINT8_MAX, uint8_t,
+    std::conditional_t<MaxCount <= UINT16_MAX, uint16_t,
+    std::conditional_t<MaxCount <= UINT32_MAX, uint32_t, size_t>>>;
+
+/**
+ * @tparam DataType  Element type; must be default constructible (every slot is constructed up front).
+ * @tparam MaxCount  Maximum number of elements.
+ * @tparam CountType Type used to store the element count; defaults to the smallest type that fits MaxCount.
+ */
+template <typename DataType, size_t MaxCount, typename CountType = DynamicArrayCountType<MaxCount>>
 class DynamicArray
 {
+    static_assert(std::is_unsigned<CountType>::value, "CountType must be an unsigned integer type.");
+    static_assert(MaxCount <= std::numeric_limits<CountType>::max(), "CountType is too small for MaxCount.");
+
 public:
 
     DynamicArray() : data(), count(0) {}
@@ -30,11 +51,11 @@ public:
 		data(),
 		count(0)
     {
-    	count = std::min(static_cast<uint8_t>(targets.size()), MaxCount);  /// Only copy as many elements as will fit
+    	count = static_cast<CountType>(std::min(targets.size(), MaxCount));  /// Only copy as many elements as will fit
         std::copy(targets.begin(), targets.begin() + count, data.begin());
     }
 
-    /// Copy constructor
+    /// Copy constructor (copies the live elements only)
     DynamicArray(const DynamicArray& other) noexcept :
         data(),
         count(other.count)
@@ -42,6 +63,15 @@ public:
         std::copy(other.data.begin(), other.data.begin() + count, data.begin());
     }
 
+    /// Move constructor (moves the live elements only; the source is left empty)
+    DynamicArray(DynamicArray&& other) noexcept :
+        data(),
+        count(other.count)
+    {
+        std::move(other.data.begin(), other.data.begin() + count, data.begin());
+        other.count = 0;
+    }
+
     /// Copy assignment operator
     DynamicArray& operator=(const DynamicArray& other) noexcept
     {
@@ -52,6 +82,17 @@ public:
         return *this;
     }
 
+    /// Move assignment operator (the source is left empty)
+    DynamicArray& operator=(DynamicArray&& other) noexcept
+    {
+        if (this != &other) {
+            count = other.count;
+            std::move(other.data.begin(), other.data.begin() + count, data.begin());
+            other.count = 0;
+        }
+        return *this;
+    }
+
     bool Append(const DataType& item) {
         if (count < MaxCount) {
             data[count++] = item;
@@ -60,19 +101,55 @@ public:
         return false;
     }
 
-    bool Remove(std::function<bool(const DataType&)>& condition) {
-        auto it = std::find_if(begin(), end(), condition);
+    bool Append(DataType&& item) {
+        if (count < MaxCount) {
+            data[count++] = std::move(item);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Constructs an element from `args` and moves it into the next free slot.
+     * @return True if there was room, false otherwise (nothing is constructed).
+     */
+    template <typename... Args>
+    bool emplace_back(Args&&... args) {
+        if (count < MaxCount) {
+            data[count++] = DataType(std::forward<Args>(args)...);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Removes the first element matching `condition`; the last element takes its place.
+     * @param condition Any callable `bool(const DataType&)`.
+     */
+    template <typename Predicate>
+    bool Remove(Predicate&& condition) {
+        auto it = std::find_if(begin(), end(), std::forward<Predicate>(condition));
         if (it != end()) {
-            std::swap(*it, data[--count]);
+            --count;
+            if (&*it != &data[count]) {
+                *it = std::move(data[count]);
+            }
             return true;
         }
         return false;
     }
 
     bool Insert(size_t index, const DataType& item) {
+        return Insert(index, DataType(item));
+    }
+
+    /**
+     * @brief Inserts `item` before position `index`, shifting only the live elements after it.
+     */
+    bool Insert(size_t index, DataType&& item) {
         if (index <= count && count < MaxCount) {
-            std::rotate(data.begin() + index, data.begin() + count, data.end());
-            data[index] = item;
+            data[count] = std::move(item);
+            std::rotate(data.begin() + index, data.begin() + count, data.begin() + count + 1);
             ++count;
             return true;
         }
@@ -336,7 +413,7 @@ public:
 
 private:
     std::array<DataType, MaxCount> data;
-    uint8_t count;
+    CountType count;
 };
 
 
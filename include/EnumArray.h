@@ -7,6 +7,13 @@
 #define HF_UTILS_GENERAL_ENUMARRAY_H_
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "DeltaEncoding.h"
 
 /**
  * @brief A generic array indexed by an enumeration type.
@@ -17,9 +24,13 @@
  * @tparam EnumType The enumeration type used as indices.
  * @tparam EnumObjectType The type of objects stored in the array.
  * @tparam Size The size of the array.
+ * @tparam TrackChanges When true, entries modified since the last TakeDelta() are
+ *         tracked so only they need to be published (see DeltaEncoding.h). Mutable
+ *         access through operator(), front() or back() counts as a modification;
+ *         use Set() to mark an entry only when its value actually changes.
  */
-template <typename EnumType, typename EnumObjectType, size_t Size>
-class EnumArray {
+template <typename EnumType, typename EnumObjectType, size_t Size, bool TrackChanges = false>
+class EnumArray : private hf_utils::DirtyBitmap<TrackChanges ? Size : 0> {
 public:
     /**
      * @brief Default constructor initializes the array.
@@ -42,9 +53,27 @@ public:
      * @return Reference to the object stored at the specified index.
      */
     EnumObjectType& operator()(EnumType index) {
+        Dirty().Mark(static_cast<size_t>(index));
         return data_[static_cast<size_t>(index)];
     }
 
+    /**
+     * @brief Assigns a value to one element, marking it modified only if it changed.
+     *
+     * @param index Array index (enum value).
+     * @param value The value to assign.
+     */
+    void Set(EnumType index, const EnumObjectType& value) {
+        EnumObjectType& slot = data_[static_cast<size_t>(index)];
+        if constexpr (TrackChanges) {
+            if (slot == value) {
+                return;
+            }
+            Dirty().Mark(static_cast<size_t>(index));
+        }
+        slot = value;
+    }
+
     /**
      * @brief Assignment operator for assigning an EnumObjectType directly to all elements.
      *
@@ -55,6 +84,7 @@ public:
         for (size_t i = 0; i < Size; ++i) {
             data_[i] = value;
         }
+        Dirty().MarkAll();
         return *this;
     }
 
@@ -66,6 +96,7 @@ public:
      */
     EnumArray& operator=(std::pair<EnumType, EnumObjectType> keyValue) {
         data_[static_cast<size_t>(keyValue.first)] = keyValue.second;
+        Dirty().Mark(static_cast<size_t>(keyValue.first));
         return *this;
     }
 
@@ -88,6 +119,7 @@ public:
     EnumArray& operator=(const EnumArray& other) {
         if (this != &other) {
             data_ = other.data_;
+            Dirty().MarkAll();
         }
         return *this;
     }
@@ -115,14 +147,62 @@ public:
     // Forwarding methods
     bool empty() const { return data_.empty(); }
     size_t size() const { return data_.size(); }
-    EnumObjectType& front() { return data_.front(); }
+    EnumObjectType& front() { Dirty().Mark(0); return data_.front(); }
     const EnumObjectType& front() const { return data_.front(); }
-    EnumObjectType& back() { return data_.back(); }
+    EnumObjectType& back() { Dirty().Mark(Size - 1); return data_.back(); }
     const EnumObjectType& back() const { return data_.back(); }
-    void fill(const EnumObjectType& value) { data_.fill(value); }
-    void swap(EnumArray& other) noexcept { data_.swap(other.data_); }
+    void fill(const EnumObjectType& value) { data_.fill(value); Dirty().MarkAll(); }
+    void swap(EnumArray& other) noexcept { data_.swap(other.data_); Dirty().MarkAll(); other.Dirty().MarkAll(); }
+
+    /**
+     * @brief Identifies if any element was modified since the last TakeDelta().
+     */
+    bool HasChanges() const noexcept { return Dirty().Any(); }
+
+    /**
+     * @brief Marks every element modified, so the next TakeDelta() emits the whole table.
+     */
+    void MarkAllChanged() noexcept { Dirty().MarkAll(); }
+
+    /**
+     * @brief Encodes the modified elements as (index, value) runs and clears their marks.
+     *
+     * Elements that do not fit in the buffer stay marked for the next call.
+     *
+     * @param buffer Destination buffer.
+     * @param capacity Size of the buffer in bytes.
+     * @return Number of bytes written (0 if nothing changed).
+     */
+    size_t TakeDelta(uint8_t* buffer, size_t capacity) noexcept {
+        static_assert(TrackChanges, "TakeDelta() requires TrackChanges = true.");
+        static_assert(std::is_trivially_copyable<EnumObjectType>::value, "Delta values are copied bytewise.");
+        return hf_utils::EncodeDeltaRuns(Dirty(), sizeof(EnumObjectType), buffer, capacity,
+            [this](size_t index, uint8_t* dst) { std::memcpy(dst, &data_[index], sizeof(EnumObjectType)); });
+    }
+
+    /**
+     * @brief Applies runs produced by TakeDelta() on another EnumArray of the same type.
+     *
+     * @param delta Encoded runs.
+     * @param length Size of the delta in bytes.
+     * @return False if the delta is malformed; runs before the fault are applied.
+     */
+    bool ApplyDelta(const uint8_t* delta, size_t length) noexcept {
+        static_assert(std::is_trivially_copyable<EnumObjectType>::value, "Delta values are copied bytewise.");
+        return hf_utils::DecodeDeltaRuns(delta, length, sizeof(EnumObjectType), Size,
+            [this](size_t index, const uint8_t* src) {
+                std::memcpy(&data_[index], src, sizeof(EnumObjectType));
+                Dirty().Mark(index);
+            });
+    }
 
 private:
+    /// Modified elements. Held as an empty base when not tracking, so untracked arrays stay sizeof(data_).
+    using DirtyMarks = hf_utils::DirtyBitmap<TrackChanges ? Size : 0>;
+
+    DirtyMarks& Dirty() noexcept { return *this; }
+    const DirtyMarks& Dirty() const noexcept { return *this; }
+
     std::array<EnumObjectType, Size> data_;
 };
 
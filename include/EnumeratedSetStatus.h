@@ -6,6 +6,7 @@
 #ifndef HF_UTILS_GENERAL_ENUMERATEDSETSTATUS_H
 #define HF_UTILS_GENERAL_ENUMERATEDSETSTATUS_H
 
+#include <DeltaEncoding.h>
 #include <MultibitSet.h>
 #include <Utility.h>
 
@@ -17,9 +18,12 @@
  * @tparam BitsPerStatus The number of bits per status entry
  * @tparam BitsPerEntry The number of enumeration entries
  * @tparam EntryCount   The number of entries.
- * Internally, a std::bitset is used to store the content.
+ * @tparam TrackChanges When true, entries whose status changed since the last TakeDelta() are tracked so that
+ *         only they need to be published (see DeltaEncoding.h).
+ * Internally, a MultibitSet (packed 64-bit words) is used to store the content.
  */
-template <typename EnumerationType, typename StatusType,  uint8_t BitsPerStatus, uint16_t EntryCount> class EnumeratedSetStatus
+template <typename EnumerationType, typename StatusType,  uint8_t BitsPerStatus, uint16_t EntryCount, bool TrackChanges = false> class EnumeratedSetStatus
+	: private hf_utils::DirtyBitmap<TrackChanges ? EntryCount : 0>
 {
 
 public:
@@ -61,6 +65,7 @@ public:
 	void Erase() noexcept
 	{
 		collection.erase();
+		Dirty().MarkAll();
 	}
 
 	/**
@@ -70,15 +75,25 @@ public:
 	  */
     void Set(EnumerationType enumeration, StatusType status) noexcept
     {
+    	if constexpr ( TrackChanges )
+    	{
+    		if ( collection.get( std::to_underlying(enumeration) ) == std::to_underlying( status ) )
+    		{
+    			return;
+    		}
+    		Dirty().Mark( std::to_underlying(enumeration) );
+    	}
     	collection.set( std::to_underlying(enumeration), std::to_underlying( status ));
     }
 
+    /**
+      * @brief Sets every element of the collection to the same status (word-wide pattern fill)
+      * @param status - Status value to associate with every entry
+	  */
     void SetAll( StatusType status) noexcept
     {
-    	for ( uint16_t entryIndex = 0; entryIndex < collection.size(); ++entryIndex )
-    	{
-    		collection.set( entryIndex, std::to_underlying(status) );
-    	}
+    	collection.fill( std::to_underlying(status) );
+    	Dirty().MarkAll();
     }
 
     /**
@@ -99,15 +114,31 @@ public:
    	  */
     bool IsAny(StatusType status) const noexcept
     {
-    	for ( uint16_t errorIndex = 0; errorIndex < collection.size(); ++errorIndex )
-		{
-			uint8_t value = collection.get(errorIndex);
-			if( value == std::to_underlying( status ))
-			{
-				return true;
-			}
-		}
-		return false;
+    	return collection.any( std::to_underlying( status ) );
+    }
+
+    /**
+   	  * @brief Counts the elements of the collection with the specified status
+   	  * @param status - Status value to be counted.
+   	  * @returns - number of elements with the Status value.
+   	  */
+    uint16_t CountStatus(StatusType status) const noexcept
+    {
+    	return collection.count( std::to_underlying( status ) );
+    }
+
+    /**
+   	  * @brief Calls `callback(enumeration)` for every element with the specified status, in index order
+   	  * @param status - Status value to be matched.
+   	  * @param callback - Callable taking an EnumerationType.
+   	  */
+    template <typename Callback>
+    void ForEachWithStatus(StatusType status, Callback&& callback) const
+    {
+    	for ( uint16_t entryIndex : collection.matches( std::to_underlying( status ) ) )
+    	{
+    		callback( EnumerationType( entryIndex ) );
+    	}
     }
 
     /**
@@ -133,6 +164,47 @@ public:
         return !IsStatus(enumeration, status);
     }
 
+    /**
+     * @brief Identifies if any element changed status since the last TakeDelta()
+     */
+    bool HasChanges() const noexcept
+    {
+    	return Dirty().Any();
+    }
+
+    /**
+     * @brief Marks every element changed, so the next TakeDelta() emits the whole set (e.g. for a new subscriber)
+     */
+    void MarkAllChanged() noexcept
+    {
+    	Dirty().MarkAll();
+    }
+
+    /**
+     * @brief Encodes the changed elements as (index, status) runs, one byte per status, and clears their marks
+     * @param buffer - Destination buffer.
+     * @param capacity - Size of the buffer in bytes.
+     * @returns - number of bytes written (0 if nothing changed).  Elements that do not fit stay marked.
+     */
+    size_t TakeDelta(uint8_t* buffer, size_t capacity) noexcept
+    {
+    	static_assert( TrackChanges, "TakeDelta() requires TrackChanges = true." );
+    	return hf_utils::EncodeDeltaRuns( Dirty(), 1U, buffer, capacity,
+    			[this]( size_t index, uint8_t* dst ) { *dst = collection.get( uint16_t( index ) ); } );
+    }
+
+    /**
+     * @brief Applies runs produced by TakeDelta() on another set of the same type
+     * @param delta - Encoded runs.
+     * @param length - Size of the delta in bytes.
+     * @returns - false if the delta is malformed (runs before the fault are applied), true otherwise.
+     */
+    bool ApplyDelta(const uint8_t* delta, size_t length) noexcept
+    {
+    	return hf_utils::DecodeDeltaRuns( delta, length, 1U, EntryCount,
+    			[this]( size_t index, const uint8_t* src ) { Set( EnumerationType( index ), StatusType( *src ) ); } );
+    }
+
 	const char* ToStatusString(StatusType status) noexcept
 	{
 
@@ -160,6 +232,12 @@ public:
 
 private:
 
+	/// Entries changed since the last TakeDelta().  Held as an empty base when not tracking, so it costs no storage.
+	using DirtyMarks = hf_utils::DirtyBitmap<TrackChanges ? EntryCount : 0>;
+
+	DirtyMarks& Dirty() noexcept { return *this; }
+	const DirtyMarks& Dirty() const noexcept { return *this; }
+
 	const char* (*enumToString)( EnumerationType );
 	const char* (*statusToString)( StatusType );
     MultibitSet<BitsPerStatus, EntryCount> collection;     ///< Bitset to store errors ( 2 bit status per entry ), using 0: unknown, 1:cleared, 2: set, 3:ignored
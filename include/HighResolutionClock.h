@@ -0,0 +1,105 @@
+/**
+ * @file HighResolutionClock.h
+ * @brief Cycle-counter based timestamp source with nanosecond conversion.
+ *
+ * `CycleClock::Now()` returns a raw, monotonically increasing tick count
+ * from the cheapest counter available:
+ * - x86 / x86-64 (GCC / Clang): `rdtsc`. The tick rate is calibrated once
+ *   against `std::chrono::steady_clock` on first use (~5 ms busy wait).
+ *   Assumes an invariant TSC, which every x86 part of the last decade has.
+ * - AArch64: the generic timer `CNTVCT_EL0`; the rate comes from
+ *   `CNTFRQ_EL0`, so no calibration is needed.
+ * - Anything else: `std::chrono::steady_clock` in nanoseconds.
+ *
+ * Use `TicksToNs()` to convert differences. Timestamps are only comparable
+ * within one process.
+ *
+ * ### Threading and allocation
+ * - No allocation. `Now()` is wait-free; the one-time calibration is
+ *   guarded by a function-local static.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_HIGHRESOLUTIONCLOCK_H_
+#define HF_UTILS_GENERAL_HIGHRESOLUTIONCLOCK_H_
+
+#include <chrono>
+#include <cstdint>
+
+namespace hf_utils {
+
+/**
+ * @brief Raw tick source plus tick→ns conversion.
+ */
+class CycleClock {
+public:
+    /**
+     * @brief Current raw tick count.
+     */
+    static uint64_t Now() noexcept
+    {
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+        return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+        uint64_t ticks;
+        __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(ticks));
+        return ticks;
+#else
+        return SteadyNowNs();
+#endif
+    }
+
+    /**
+     * @brief Tick rate of `Now()` in Hz.
+     */
+    static uint64_t TicksPerSecond() noexcept
+    {
+        static const uint64_t rate = MeasureTicksPerSecond();
+        return rate;
+    }
+
+    /**
+     * @brief Convert a tick difference to nanoseconds.
+     */
+    static uint64_t TicksToNs(uint64_t ticks) noexcept
+    {
+        static const double nsPerTick = 1e9 / static_cast<double>(TicksPerSecond());
+        return static_cast<uint64_t>(static_cast<double>(ticks) * nsPerTick);
+    }
+
+    /**
+     * @brief Current time in nanoseconds on the same timeline as `Now()`.
+     */
+    static uint64_t NowNs() noexcept { return TicksToNs(Now()); }
+
+private:
+    static uint64_t SteadyNowNs() noexcept
+    {
+        using namespace std::chrono;
+        return static_cast<uint64_t>(
+            duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+    }
+
+    static uint64_t MeasureTicksPerSecond() noexcept
+    {
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+        const uint64_t ns0 = SteadyNowNs();
+        const uint64_t c0  = Now();
+        uint64_t ns1 = ns0;
+        while (ns1 - ns0 < 5000000U) { ns1 = SteadyNowNs(); }
+        const uint64_t c1 = Now();
+        return static_cast<uint64_t>(static_cast<double>(c1 - c0) * 1e9 / static_cast<double>(ns1 - ns0));
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+        uint64_t freq;
+        __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(freq));
+        return freq;
+#else
+        return 1000000000U;
+#endif
+    }
+};
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_HIGHRESOLUTIONCLOCK_H_ */
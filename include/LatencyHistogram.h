@@ -0,0 +1,193 @@
+/**
+ * @file LatencyHistogram.h
+ * @brief Fixed-memory HDR-style histogram for latency samples.
+ *
+ * Values below `2^SubBucketBits` are recorded exactly. Larger values are
+ * bucketed by their most-significant bit with `2^(SubBucketBits-1)` linear
+ * sub-buckets per power of two, which bounds the relative error of any
+ * reported percentile by `1 / 2^(SubBucketBits-1)` (0.78 % for the default
+ * of 8 bits). Values above `2^MaxValueBits - 1` saturate into the last
+ * bucket; the exact maximum is tracked separately.
+ *
+ * Memory is `(MaxValueBits - SubBucketBits + 2) * 2^(SubBucketBits-1)`
+ * `uint32_t` counters, e.g. 17 KiB for the defaults (ns up to ~18 min).
+ *
+ * ### Threading and allocation
+ * - No allocation; counters live in a `std::array`.
+ * - Not thread-safe: one writer, and readers must be serialised with it.
+ *   Merge per-thread histograms with `Merge()` for reporting.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_LATENCYHISTOGRAM_H_
+#define HF_UTILS_GENERAL_LATENCYHISTOGRAM_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "BitOps.h"
+
+namespace hf_utils {
+
+/**
+ * @brief Percentile summary produced by `LatencyHistogram::Summarize()`.
+ */
+struct LatencySummary {
+    uint64_t count{0}; ///< Samples recorded.
+    uint64_t min{0};   ///< Exact minimum.
+    uint64_t p50{0};   ///< Median.
+    uint64_t p90{0};   ///< 90th percentile.
+    uint64_t p99{0};   ///< 99th percentile.
+    uint64_t p999{0};  ///< 99.9th percentile.
+    uint64_t max{0};   ///< Exact maximum.
+    uint64_t mean{0};  ///< Arithmetic mean.
+};
+
+/**
+ * @brief HDR-style log-linear histogram.
+ *
+ * @tparam SubBucketBits Precision bits; relative error ≤ `2^-(SubBucketBits-1)`.
+ * @tparam MaxValueBits  Largest distinguishable value is `2^MaxValueBits - 1`.
+ */
+template <unsigned SubBucketBits = 8U, unsigned MaxValueBits = 40U>
+class LatencyHistogram {
+public:
+    static_assert(SubBucketBits >= 2U && SubBucketBits <= 16U, "SubBucketBits must be in [2, 16].");
+    static_assert(MaxValueBits > SubBucketBits && MaxValueBits <= 64U, "MaxValueBits must be in (SubBucketBits, 64].");
+
+    /// Linear sub-buckets per power of two.
+    static constexpr size_t kHalfSubBuckets = size_t{1} << (SubBucketBits - 1U);
+    /// Total counter count.
+    static constexpr size_t kBucketCount = (MaxValueBits - SubBucketBits + 2U) * kHalfSubBuckets;
+
+    LatencyHistogram() noexcept { Reset(); }
+
+    /**
+     * @brief Record one sample.
+     */
+    void Record(uint64_t value) noexcept { RecordN(value, 1U); }
+
+    /**
+     * @brief Record `n` samples of the same value.
+     */
+    void RecordN(uint64_t value, uint32_t n) noexcept
+    {
+        if (n == 0U) { return; }
+        counts_[IndexOf(value)] += n;
+        count_ += n;
+        sum_   += value * n;
+        if (value < min_) { min_ = value; }
+        if (value > max_) { max_ = value; }
+    }
+
+    /// @return Samples recorded.
+    uint64_t Count() const noexcept { return count_; }
+
+    /// @return Exact minimum (0 if empty).
+    uint64_t Min() const noexcept { return count_ ? min_ : 0U; }
+
+    /// @return Exact maximum (0 if empty).
+    uint64_t Max() const noexcept { return max_; }
+
+    /// @return Arithmetic mean (0 if empty).
+    uint64_t Mean() const noexcept { return count_ ? sum_ / count_ : 0U; }
+
+    /**
+     * @brief Value at or below which `percentile` % of samples fall.
+     *
+     * @param percentile In `[0, 100]`.
+     * @return Upper edge of the bucket holding that rank, clamped to `Max()`.
+     */
+    uint64_t ValueAtPercentile(double percentile) const noexcept
+    {
+        if (count_ == 0U) { return 0U; }
+        if (percentile <= 0.0)   { return Min(); }
+        if (percentile >= 100.0) { return max_; }
+
+        uint64_t rank = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(count_) + 0.5);
+        if (rank == 0U) { rank = 1U; }
+
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kBucketCount; ++i) {
+            seen += counts_[i];
+            if (seen >= rank) {
+                if (i == kBucketCount - 1U) { return max_; } // saturated bucket
+                const uint64_t edge = HighestEquivalent(i);
+                return (edge < max_) ? edge : max_;
+            }
+        }
+        return max_;
+    }
+
+    /**
+     * @brief p50 / p90 / p99 / p99.9 / max in one pass-equivalent call.
+     */
+    LatencySummary Summarize() const noexcept
+    {
+        LatencySummary s{};
+        s.count = count_;
+        s.min   = Min();
+        s.p50   = ValueAtPercentile(50.0);
+        s.p90   = ValueAtPercentile(90.0);
+        s.p99   = ValueAtPercentile(99.0);
+        s.p999  = ValueAtPercentile(99.9);
+        s.max   = max_;
+        s.mean  = Mean();
+        return s;
+    }
+
+    /**
+     * @brief Add another histogram's samples into this one.
+     */
+    void Merge(const LatencyHistogram& other) noexcept
+    {
+        for (size_t i = 0; i < kBucketCount; ++i) { counts_[i] += other.counts_[i]; }
+        count_ += other.count_;
+        sum_   += other.sum_;
+        if (other.count_ != 0U && other.min_ < min_) { min_ = other.min_; }
+        if (other.max_ > max_) { max_ = other.max_; }
+    }
+
+    /**
+     * @brief Drop all samples.
+     */
+    void Reset() noexcept
+    {
+        counts_.fill(0U);
+        count_ = 0U;
+        sum_   = 0U;
+        min_   = ~uint64_t{0};
+        max_   = 0U;
+    }
+
+private:
+    static constexpr uint64_t kExactLimit = uint64_t{1} << SubBucketBits;
+
+    static size_t IndexOf(uint64_t value) noexcept
+    {
+        if (value < kExactLimit) { return static_cast<size_t>(value); }
+        const unsigned shift = MostSignificantBit(value) - (SubBucketBits - 1U);
+        const size_t index = static_cast<size_t>(shift) * kHalfSubBuckets + static_cast<size_t>(value >> shift);
+        return (index < kBucketCount) ? index : (kBucketCount - 1U);
+    }
+
+    static uint64_t HighestEquivalent(size_t index) noexcept
+    {
+        if (index < kExactLimit) { return index; }
+        const size_t shift = index / kHalfSubBuckets - 1U;
+        const uint64_t sub = index - shift * kHalfSubBuckets;
+        return ((sub + 1U) << shift) - 1U;
+    }
+
+    std::array<uint32_t, kBucketCount> counts_{};
+    uint64_t count_{0};
+    uint64_t sum_{0};
+    uint64_t min_{0};
+    uint64_t max_{0};
+};
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_LATENCYHISTOGRAM_H_ */
@@ -8,18 +8,21 @@
 
 /**
  * @file LineEstimator.h
- * @brief Contains the LineEstimator class for estimating the slope of a line from data points.
+ * @brief Contains the LineEstimator class for estimating the slope of a line from data points,
+ *        and the streaming O(1) StreamingLineEstimator.
  */
 
 #include <array>
 #include <utility> // for std::pair
 #include <cstddef>
+#include <type_traits>
 
 /**
  * @class LineEstimator
  * @brief A class for estimating the slope of a line from data points.
  *
  * Uses a fixed-capacity std::array so no heap allocation is required.
+ * For live data, or when the slope is read often, see hf_utils::StreamingLineEstimator.
  *
  * @tparam MaxPoints  Maximum number of data points the estimator can hold.
  */
@@ -68,20 +71,26 @@ public:
             return 0.0f;
         }
 
-        float x_sum = 0.0f, y_sum = 0.0f, xy_sum = 0.0f, xx_sum = 0.0f;
+        // Two passes over centered values in double: the raw-sum form cancels catastrophically
+        // when x is large relative to its spread (e.g. timestamps).
+        double x_mean = 0.0, y_mean = 0.0;
         for (size_t i = 0; i < count_; ++i) {
-            x_sum += data_[i].first;
-            y_sum += data_[i].second;
-            xy_sum += data_[i].first * data_[i].second;
-            xx_sum += data_[i].first * data_[i].first;
+            x_mean += data_[i].first;
+            y_mean += data_[i].second;
         }
+        x_mean /= static_cast<double>(count_);
+        y_mean /= static_cast<double>(count_);
 
-        float n = static_cast<float>(count_);
-        float denom = n * xx_sum - x_sum * x_sum;
-        if (denom == 0.0f) {
+        double xx_sum = 0.0, xy_sum = 0.0;
+        for (size_t i = 0; i < count_; ++i) {
+            const double dx = data_[i].first - x_mean;
+            xx_sum += dx * dx;
+            xy_sum += dx * (data_[i].second - y_mean);
+        }
+        if (xx_sum == 0.0) {
             return 0.0f;
         }
-        return (n * xy_sum - x_sum * y_sum) / denom;
+        return static_cast<float>(xy_sum / xx_sum);
     }
 
 private:
@@ -89,4 +98,184 @@ private:
     size_t count_ = 0;
 };
 
+namespace hf_utils {
+
+/**
+ * @brief Least-squares line fit with O(1) add, evict and slope / intercept / R².
+ *
+ * Keeps the point count, the means and the centered co-moments
+ * Sxx = sum (x - mean_x)^2, Syy and Sxy in double, updated Welford-style on
+ * every add and reversed on every evict, so no query ever re-scans the points
+ * and no large raw sums are subtracted from each other.
+ *
+ * With `WindowPoints > 0` the last `WindowPoints` points are kept in a ring
+ * buffer: adding to a full window evicts the oldest point, so the estimator
+ * can run indefinitely on live data. To stop rounding from add / evict pairs
+ * accumulating, a second set of moments is built from the incoming points
+ * alone (adds only, never evicts); once it spans exactly the current window
+ * it replaces the live moments and starts over. That costs one extra Welford
+ * update per add, so every AddPoint() is O(1) with no periodic re-scan. With
+ * `WindowPoints == 0` the fit is cumulative over every point added and no
+ * points are stored.
+ *
+ * ### Threading and allocation
+ * - No allocation. Not thread-safe.
+ *
+ * @tparam WindowPoints Sliding-window length (0 = unbounded, cumulative).
+ */
+template <size_t WindowPoints = 0>
+class StreamingLineEstimator {
+public:
+    /**
+     * @brief Adds a point, evicting the oldest one first when the window is full.
+     */
+    void AddPoint(float x, float y) noexcept
+    {
+        if constexpr (WindowPoints > 0) {
+            if (live_.count == WindowPoints) {
+                EvictOldest();
+            }
+            window_[(head_ + live_.count) % WindowPoints] = {x, y};
+        }
+        live_.Include(x, y);
+        if constexpr (WindowPoints > 0) {
+            shadow_.Include(x, y);
+            // The shadow holds the newest shadow_.count points; equal counts mean it is the window.
+            if (shadow_.count >= live_.count) {
+                if (shadow_.count == live_.count) {
+                    live_ = shadow_;
+                }
+                shadow_ = Moments{};
+            }
+        }
+    }
+
+    /**
+     * @brief Removes the oldest point of the window (no-op when empty).
+     */
+    void EvictOldest() noexcept
+    {
+        static_assert(WindowPoints > 0, "EvictOldest() needs a window; use RemovePoint() in cumulative mode.");
+        if (live_.count == 0) {
+            return;
+        }
+        const std::pair<float, float> oldest = window_[head_];
+        head_ = (head_ + 1) % WindowPoints;
+        live_.Exclude(oldest.first, oldest.second);
+    }
+
+    /**
+     * @brief Removes a previously added point from a cumulative fit.
+     */
+    void RemovePoint(float x, float y) noexcept
+    {
+        static_assert(WindowPoints == 0, "RemovePoint() is for cumulative mode; windows evict automatically.");
+        if (live_.count > 0) {
+            live_.Exclude(x, y);
+        }
+    }
+
+    /**
+     * @brief Removes every point.
+     */
+    void Clear() noexcept
+    {
+        head_ = 0;
+        live_ = Moments{};
+        if constexpr (WindowPoints > 0) {
+            shadow_ = Moments{};
+        }
+    }
+
+    /// @return Number of points in the fit.
+    [[nodiscard]] size_t Size() const noexcept { return live_.count; }
+
+    /// @return Window length (0 = unbounded).
+    [[nodiscard]] static constexpr size_t Capacity() noexcept { return WindowPoints; }
+
+    /// @return Least-squares slope; 0 with fewer than two distinct x values.
+    [[nodiscard]] double Slope() const noexcept
+    {
+        return (live_.count >= 2 && live_.sxx > 0.0) ? live_.sxy / live_.sxx : 0.0;
+    }
+
+    /// @return Least-squares intercept (mean y with fewer than two distinct x values).
+    [[nodiscard]] double Intercept() const noexcept { return live_.meanY - Slope() * live_.meanX; }
+
+    /// @return Coefficient of determination in [0, 1]; 0 when undefined (constant x or y).
+    [[nodiscard]] double RSquared() const noexcept
+    {
+        if (live_.count < 2 || live_.sxx <= 0.0 || live_.syy <= 0.0) {
+            return 0.0;
+        }
+        const double r2 = (live_.sxy * live_.sxy) / (live_.sxx * live_.syy);
+        return r2 < 1.0 ? r2 : 1.0;
+    }
+
+    /// @return Fitted y at `x`.
+    [[nodiscard]] double Predict(double x) const noexcept { return live_.meanY + Slope() * (x - live_.meanX); }
+
+    /// @return Slope as float, matching LineEstimator::EstimateSlope().
+    [[nodiscard]] float EstimateSlope() const noexcept { return static_cast<float>(Slope()); }
+
+    [[nodiscard]] double MeanX() const noexcept { return live_.meanX; }
+    [[nodiscard]] double MeanY() const noexcept { return live_.meanY; }
+
+private:
+    /// Count, means and centered co-moments of a set of points.
+    struct Moments {
+        size_t count = 0;
+        double meanX = 0.0;
+        double meanY = 0.0;
+        double sxx = 0.0;
+        double syy = 0.0;
+        double sxy = 0.0;
+
+        void Include(double x, double y) noexcept
+        {
+            ++count;
+            const double n = static_cast<double>(count);
+            const double dx = x - meanX;
+            const double dy = y - meanY;
+            meanX += dx / n;
+            meanY += dy / n;
+            sxx += dx * (x - meanX);
+            syy += dy * (y - meanY);
+            sxy += dx * (y - meanY);
+        }
+
+        void Exclude(double x, double y) noexcept
+        {
+            if (count == 1) {
+                *this = Moments{};
+                return;
+            }
+            --count;
+            const double n = static_cast<double>(count);
+            const double dx = x - meanX;
+            const double dy = y - meanY;
+            meanX -= dx / n;
+            meanY -= dy / n;
+            sxx -= dx * (x - meanX);
+            syy -= dy * (y - meanY);
+            sxy -= dx * (y - meanY);
+            sxx = sxx > 0.0 ? sxx : 0.0;      // rounding can leave a tiny negative
+            syy = syy > 0.0 ? syy : 0.0;
+        }
+    };
+
+    struct NoWindow {};
+    using Window = std::conditional_t<(WindowPoints > 0),
+                                      std::array<std::pair<float, float>, (WindowPoints > 0 ? WindowPoints : 1)>,
+                                      NoWindow>;
+    using Shadow = std::conditional_t<(WindowPoints > 0), Moments, NoWindow>;
+
+    Window window_{};
+    size_t head_ = 0;
+    Moments live_{};      ///< Moments of the current window (or of every point, when cumulative)
+    Shadow shadow_{};     ///< Add-only moments of the newest points; replaces live_ once it spans the window
+};
+
+} // namespace hf_utils
+
 #endif /* HF_UTILS_GENERAL_LINEESTIMATOR_H_ */
@@ -1,36 +1,55 @@
 /**
  * @file MultibitSet.h
- * @brief Small wrapper around std::bitset for multi-bit entries.
+ * @brief Packed array of small multi-bit entries.
  *
- * The MultibitSet template manages a bitset partitioned into logical entries of
+ * The MultibitSet template manages a bit array partitioned into logical entries of
  * a fixed size.  Each element stores `BitsPerEntry` bits and the class provides
  * helpers to set, clear and fetch those fields by index.
+ *
+ * Storage is an array of 64-bit words; entry `i` occupies bits
+ * `[i * BitsPerEntry, (i + 1) * BitsPerEntry)` counted from bit 0 of word 0, so
+ * get/set are one mask-and-shift (two when an entry straddles a word boundary).
+ * Bits past the last entry are always zero.
+ *
+ * When `BitsPerEntry` divides 64 (1, 2, 4, 8) no entry straddles a word and the
+ * search queries (`any`, `count`, `matches`) compare a whole word of entries at
+ * once with a SWAR zero-field test; other widths fall back to per-entry get().
  * @todo Add @copyright line once project copyright wording is finalised.
  */
 
 #ifndef HF_UTILS_GENERAL_MULTIBITSET_H
 #define HF_UTILS_GENERAL_MULTIBITSET_H
 
-#include <bitset>
+#include <array>
 #include <cstdint>
 
+#include "BitOps.h"
+
 /**
  * @class MultiBitSet
- * @brief This class is used to a multi-bit value into a std::bitset
+ * @brief This class is used to pack multi-bit values into an array of 64-bit words
  * @tparam BitsPerEntry The number of bits per entry
  * @tparam EntryCount   The number of entries.
  */
 template < uint8_t BitsPerEntry, uint16_t EntryCount> class MultibitSet
 {
+	static_assert(BitsPerEntry >= 1 && BitsPerEntry <= 8, "BitsPerEntry must be in [1, 8] (values are uint8_t).");
 
 public:
+	using Word = uint64_t;
+
+	static constexpr uint16_t WordBits = 64;                                            ///< Bits per storage word
+	static constexpr uint32_t TotalBits = uint32_t(BitsPerEntry) * EntryCount;          ///< Bits used by entries
+	static constexpr uint16_t WordCount = uint16_t((TotalBits + WordBits - 1) / WordBits); ///< Storage words
+	static constexpr Word EntryMask = (Word(1) << BitsPerEntry) - 1;                    ///< Mask of one entry at bit 0
+
 	/**
 	 * @brief Constructor for MultiBitSet.
 	 * @param initialValueArg - specified the initial bit sequence to save in each cell for un-itialized state.
 	 */
 	MultibitSet( uint8_t initialValueArg = 0 ) noexcept :
 		initialValue(initialValueArg),
-		bitset()
+		words()
 	{
 	   erase();
 	}
@@ -54,10 +73,30 @@ public:
 	 */
 	void erase() noexcept
 	{
-		for( uint16_t valueIndex = 0; valueIndex < size(); ++valueIndex )
+		fill( initialValue );
+	}
+
+	/**
+	  * @brief Sets every element of the multi-set to the same value
+	  * @param value - value to store ( only least BitsPerEntry are saved )
+	  *
+	  * Builds the replicated bit pattern once (it repeats every PatternWords words)
+	  * and copies it word by word, instead of setting entries one at a time.
+	  */
+	void fill( uint8_t value ) noexcept
+	{
+		std::array<Word, PatternWords> pattern{};
+		const Word field = Word(value) & EntryMask;
+		for( uint32_t bit = 0; bit < uint32_t(PatternWords) * WordBits; bit += BitsPerEntry )
+		{
+			WriteField( pattern.data(), PatternWords, bit, field );
+		}
+
+		for( uint16_t wordIndex = 0; wordIndex < WordCount; ++wordIndex )
 		{
-			clear( valueIndex);
+			words[wordIndex] = pattern[wordIndex % PatternWords];
 		}
+		ClearPadding();
 	}
 
 	/**
@@ -69,16 +108,7 @@ public:
     {
     	if( valueIndex < EntryCount )
     	{
-
-    		volatile const uint16_t firstBit = valueIndex * BitsPerEntry; // BJR 5: 9
-    		volatile const uint16_t lastBit = firstBit + BitsPerEntry - 1;
-
-			uint8_t bitMask = 1 << (BitsPerEntry-1);
-			for( uint16_t bitsetIndex = firstBit; bitsetIndex <= lastBit; ++bitsetIndex )
-			{
-				bitset[bitsetIndex] = value & bitMask;     // Populate the bit
-				bitMask >>= 1;
-			}
+    		WriteField( words.data(), WordCount, uint32_t(valueIndex) * BitsPerEntry, Word(value) & EntryMask );
     	}
     }
 
@@ -102,35 +132,267 @@ public:
 
      uint8_t get( uint16_t valueIndex) const noexcept
      {
-		if( valueIndex < EntryCount )
-		{
-			uint8_t value = 0;
-			const uint16_t firstBit = valueIndex * BitsPerEntry; // BJR 5: 9
-			const uint16_t lastBit = firstBit + BitsPerEntry -1;
-
-			for( uint16_t bitsetIndex = firstBit; bitsetIndex <= lastBit; ++bitsetIndex )
-			{
-				if( bitset[bitsetIndex] )    // Populate the bit
-				{
-					value += 1;
-				}
-				if( bitsetIndex < lastBit )
-				{
-					value <<= 1;
-				}
-			}
-			return value;
-		}
-		else
-		{
-			return initialValue;
-		}
+		// Branchless: out-of-range indices read entry 0 and select the initial value instead.
+		// Besides the hot path, this leaves GCC no out-of-line part to split off; GCC before
+		// 12.4 / 13.3 (PR 113907) folds such parts across EntryCount and miscompiles callers.
+		const bool inRange = valueIndex < EntryCount;
+		const uint8_t value = ReadField( words.data(), uint32_t(inRange ? valueIndex : 0) * BitsPerEntry );
+		return inRange ? value : initialValue;
+     }
+
+     /**
+      * @brief Read-only access to the packed storage words (for word-parallel queries).
+      */
+     const std::array<Word, WordCount>& data() const noexcept
+     {
+    	 return words;
+     }
+
+     /**
+      * @brief Forward iterator over the indices of entries equal to one value.
+      *
+      * Word-aligned widths walk the SWAR match mask with count-trailing-zeros,
+      * touching only matching entries; other widths scan entries with get().
+      */
+     class MatchIterator
+     {
+     public:
+    	 uint16_t operator*() const noexcept { return index; }
+
+    	 MatchIterator& operator++() noexcept
+    	 {
+    		 if constexpr (WordAligned)
+    		 {
+    			 pending &= pending - 1;
+    			 SeekWord();
+    		 }
+    		 else
+    		 {
+    			 Scan( uint16_t(index + 1) );
+    		 }
+    		 return *this;
+    	 }
+
+    	 bool operator==( const MatchIterator& other ) const noexcept { return index == other.index; }
+    	 bool operator!=( const MatchIterator& other ) const noexcept { return index != other.index; }
+
+     private:
+    	 friend class MultibitSet;
+
+    	 MatchIterator( const MultibitSet* ownerArg, uint8_t valueArg, bool atEnd ) noexcept :
+    		 owner(ownerArg),
+    		 value(valueArg),
+    		 wordIndex(0),
+    		 pending(0),
+    		 index(EntryCount)
+    	 {
+    		 if( atEnd )
+    		 {
+    			 return;
+    		 }
+    		 if constexpr (WordAligned)
+    		 {
+    			 if( WordCount != 0 )
+    			 {
+    				 pending = owner->MatchBits( 0, value );
+    				 SeekWord();
+    			 }
+    		 }
+    		 else
+    		 {
+    			 Scan( 0 );
+    		 }
+    	 }
+
+    	 /// Advance to the next word with a match and decode the lowest match bit
+    	 void SeekWord() noexcept
+    	 {
+    		 while( pending == 0 )
+    		 {
+    			 if( ++wordIndex >= WordCount )
+    			 {
+    				 index = EntryCount;
+    				 return;
+    			 }
+    			 pending = owner->MatchBits( wordIndex, value );
+    		 }
+    		 index = uint16_t(wordIndex * EntriesPerWord + hf_utils::CountTrailingZeros( pending ) / BitsPerEntry);
+    	 }
+
+    	 void Scan( uint16_t from ) noexcept
+    	 {
+    		 for( index = from; index < EntryCount && owner->get( index ) != value; ++index ) { }
+    	 }
+
+    	 const MultibitSet* owner;
+    	 uint8_t value;
+    	 uint16_t wordIndex;
+    	 Word pending;      ///< Unvisited match bits of the current word
+    	 uint16_t index;    ///< Current match, EntryCount at the end
+     };
+
+     /**
+      * @brief Range of indices whose entry equals `value` (for range-for).
+      */
+     struct MatchRange
+     {
+    	 MatchIterator first;
+    	 MatchIterator last;
+    	 MatchIterator begin() const noexcept { return first; }
+    	 MatchIterator end() const noexcept { return last; }
+     };
+
+     /**
+      * @brief Indices of all entries equal to `value`, in ascending order.
+      */
+     MatchRange matches( uint8_t value ) const noexcept
+     {
+    	 const uint8_t field = uint8_t(value & EntryMask);
+    	 return MatchRange{ MatchIterator( this, field, false ), MatchIterator( this, field, true ) };
+     }
+
+     /**
+      * @brief Returns true if any entry equals `value`.
+      */
+     bool any( uint8_t value ) const noexcept
+     {
+    	 const uint8_t field = uint8_t(value & EntryMask);
+    	 if constexpr (WordAligned)
+    	 {
+    		 for( uint16_t wordIndex = 0; wordIndex < WordCount; ++wordIndex )
+    		 {
+    			 if( MatchBits( wordIndex, field ) != 0 )
+    			 {
+    				 return true;
+    			 }
+    		 }
+    		 return false;
+    	 }
+    	 else
+    	 {
+    		 return MatchIterator( this, field, false ) != MatchIterator( this, field, true );
+    	 }
+     }
+
+     /**
+      * @brief Returns the number of entries equal to `value`.
+      */
+     uint16_t count( uint8_t value ) const noexcept
+     {
+    	 const uint8_t field = uint8_t(value & EntryMask);
+    	 uint16_t total = 0;
+    	 if constexpr (WordAligned)
+    	 {
+    		 for( uint16_t wordIndex = 0; wordIndex < WordCount; ++wordIndex )
+    		 {
+    			 total = uint16_t(total + hf_utils::PopCount( MatchBits( wordIndex, field ) ));
+    		 }
+    	 }
+    	 else
+    	 {
+    		 for( uint16_t valueIndex = 0; valueIndex < EntryCount; ++valueIndex )
+    		 {
+    			 total = uint16_t(total + (get( valueIndex ) == field ? 1 : 0));
+    		 }
+    	 }
+    	 return total;
      }
 
 private:
 
+     /// Entry layout repeats every lcm(64, BitsPerEntry) bits
+     static constexpr uint16_t Gcd( uint16_t a, uint16_t b ) noexcept
+     {
+    	 return b == 0 ? a : Gcd( b, a % b );
+     }
+     static constexpr uint16_t PatternWords = BitsPerEntry / Gcd( WordBits, BitsPerEntry );
+
+     /**
+      * @brief Stores `field` (already masked) at bit offset `firstBit` of `target`.
+      */
+     static void WriteField( Word* target, uint16_t targetWords, uint32_t firstBit, Word field ) noexcept
+     {
+    	 const uint16_t wordIndex = uint16_t(firstBit / WordBits);
+    	 const uint16_t shift = uint16_t(firstBit % WordBits);
+
+    	 target[wordIndex] = (target[wordIndex] & ~(EntryMask << shift)) | (field << shift);
+    	 if constexpr (!WordAligned)
+    	 {
+    		 if( shift + BitsPerEntry > WordBits && wordIndex + 1 < targetWords )     // Entry straddles into the next word
+    		 {
+    			 const uint16_t lowBits = uint16_t(WordBits - shift);
+    			 target[wordIndex + 1] = (target[wordIndex + 1] & ~(EntryMask >> lowBits)) | (field >> lowBits);
+    		 }
+    	 }
+     }
+
+     /**
+      * @brief Loads the field at bit offset `firstBit` of `source`.
+      */
+     static uint8_t ReadField( const Word* source, uint32_t firstBit ) noexcept
+     {
+    	 const uint16_t wordIndex = uint16_t(firstBit / WordBits);
+    	 const uint16_t shift = uint16_t(firstBit % WordBits);
+
+    	 Word value = source[wordIndex] >> shift;
+    	 if constexpr (!WordAligned)
+    	 {
+    		 if( shift + BitsPerEntry > WordBits )     // Entry straddles into the next word
+    		 {
+    			 value |= source[wordIndex + 1] << (WordBits - shift);
+    		 }
+    	 }
+    	 return uint8_t(value & EntryMask);
+     }
+
+     static constexpr bool WordAligned = (WordBits % BitsPerEntry) == 0;  ///< No entry straddles a word
+     static constexpr uint16_t EntriesPerWord = WordBits / BitsPerEntry;
+
+     /// `pattern` replicated into every entry of a word (word-aligned widths only)
+     static constexpr Word Replicate( Word pattern ) noexcept
+     {
+    	 Word result = 0;
+    	 for( uint16_t bit = 0; bit + BitsPerEntry <= WordBits; bit = uint16_t(bit + BitsPerEntry) )
+    	 {
+    		 result |= pattern << bit;
+    	 }
+    	 return result;
+     }
+     static constexpr Word EntryOnes = Replicate( 1 );                           ///< Bit 0 of every entry
+     static constexpr Word LowEntryBits = Replicate( EntryMask >> 1 );           ///< All but the top bit of every entry
+     static constexpr Word HighEntryBits = Replicate( Word(1) << (BitsPerEntry - 1) ); ///< Top bit of every entry
+
+     /**
+      * @brief Top bit of each entry of word `wordIndex` set iff that entry equals `field`.
+      *
+      * XOR turns matching entries into zero fields; then `(x & low) + low` carries into
+      * the top bit of every non-zero field without crossing into its neighbour, so
+      * `~((x & low) + low | x | low)` leaves exactly the zero fields' top bits.
+      */
+     Word MatchBits( uint16_t wordIndex, uint8_t field ) const noexcept
+     {
+    	 const Word x = words[wordIndex] ^ (Word(field) * EntryOnes);
+    	 Word zero = ~(((x & LowEntryBits) + LowEntryBits) | x | LowEntryBits) & HighEntryBits;
+    	 if( wordIndex == WordCount - 1 && (TotalBits % WordBits) != 0 )     // Ignore padding "entries"
+    	 {
+    		 zero &= (Word(1) << (TotalBits % WordBits)) - 1;
+    	 }
+    	 return zero;
+     }
+
+     /**
+      * @brief Zeroes the bits past the last entry in the final word.
+      */
+     void ClearPadding() noexcept
+     {
+    	 if( (TotalBits % WordBits) != 0 )
+    	 {
+    		 words[WordCount - 1] &= (Word(1) << (TotalBits % WordBits)) - 1;
+    	 }
+     }
+
      uint8_t initialValue;
-	 std::bitset<BitsPerEntry * EntryCount> bitset;
+     std::array<Word, WordCount> words;   ///< Packed entries, entry 0 at bit 0 of word 0
 };
 
 
@@ -0,0 +1,807 @@
+/**
+ * @file NumericText.h
+ * @brief Locale-free, allocation-free number parsing / formatting and a
+ *        CSV / key=value line parser built on them.
+ *
+ * The API mirrors C++17 `std::from_chars` / `std::to_chars` (pointer-range
+ * in, `{ptr, error}` out, no whitespace skipping, no leading `+`) so call
+ * sites can switch to `<charconv>` later, but only needs a freestanding-ish
+ * toolchain: `<cmath>` and `<cstdint>`.
+ *
+ * - `ParseInteger()` / `FormatInteger()`: any integral type, base 2..36 for
+ *   parsing, base 10 for formatting. Overflow is reported, never wrapped.
+ * - `ParseFloat()` / `FormatFloat()`: `float` / `double`, decimal or
+ *   scientific, plus `inf` / `nan`. Formatting a `float` with the default 9
+ *   significant digits and parsing the text back reproduces the same bits.
+ *   Parsing is correctly rounded (ties to even) for every input, rounding
+ *   once straight to the target type (a `float` is never parsed as a
+ *   `double` first): digits that fit in the target mantissa (2^53 / 2^24)
+ *   with a decimal exponent within ±22 / ±10 take one exact operation in
+ *   that type; anything else is estimated and then settled by exact
+ *   big-integer comparison against the target type's neighbouring halfway
+ *   points.
+ *   Formatting is correctly rounded the same way, so 17 significant digits
+ *   (`double`) or 9 (`float`) always parse back to the same bits.
+ * - `ParseValue()`: whole-field parse of a trimmed `std::string_view`.
+ * - `ParseCsvLine()` / `SplitKeyValue()`: parse a delimited line of numbers
+ *   into a caller-owned array, or split `key=value`.
+ *
+ * \code{.cpp}
+ * float gains[4];
+ * auto r = hf_utils::ParseCsvLine("1.5, 0.25 ,-3e-2,7", gains, 4U);
+ * // r.count == 4, r.error == NumericError::None
+ *
+ * std::string_view key, value;
+ * uint32_t baud = 0;
+ * if (hf_utils::SplitKeyValue(" baud = 115200", key, value) && hf_utils::ParseValue(value, baud)) { ... }
+ * \endcode
+ *
+ * ### Threading and allocation
+ * - No allocation, no global state, no dependence on the C locale.
+ * - The exact float paths keep two fixed-size big integers on the stack
+ *   (about 700 bytes).
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_NUMERICTEXT_H_
+#define HF_UTILS_GENERAL_NUMERICTEXT_H_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+#include "StringViewUtils.h"
+
+namespace hf_utils {
+
+/**
+ * @brief Outcome of a parse / format call (subset of `std::errc`).
+ */
+enum class NumericError : uint8_t {
+    None = 0,        ///< Success.
+    InvalidArgument, ///< No number at the start of the input.
+    OutOfRange,      ///< Number does not fit the destination type.
+    ValueTooLarge,   ///< Output buffer too small.
+};
+
+/**
+ * @brief Result of a parse: first unconsumed character and error.
+ */
+struct FromCharsResult {
+    const char*  ptr;
+    NumericError error;
+};
+
+/**
+ * @brief Result of a format: one past the last written character and error.
+ */
+struct ToCharsResult {
+    char*        ptr;
+    NumericError error;
+};
+
+//==============================================================//
+/// INTEGERS
+//==============================================================//
+
+namespace numeric_text_detail {
+
+constexpr int DigitValue(char c) noexcept
+{
+    return (c >= '0' && c <= '9') ? (c - '0')
+         : (c >= 'a' && c <= 'z') ? (c - 'a' + 10)
+         : (c >= 'A' && c <= 'Z') ? (c - 'A' + 10)
+         : 99;
+}
+
+/// "00".."99" so formatting emits two digits per division
+constexpr char kDigitPairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+} // namespace numeric_text_detail
+
+/**
+ * @brief Parse an integer from `[first, last)`.
+ *
+ * Accepts an optional `-` (signed types only) followed by digits of `base`.
+ * On error `value` is left unchanged.
+ *
+ * @return `ptr` past the digits; `InvalidArgument` (ptr = first) if there are
+ *         none or `base` is outside `[2, 36]`, `OutOfRange` if the number
+ *         does not fit.
+ */
+template <typename Int>
+FromCharsResult ParseInteger(const char* first, const char* last, Int& value, int base = 10) noexcept
+{
+    static_assert(std::is_integral<Int>::value, "ParseInteger requires an integral type.");
+    using Unsigned = typename std::make_unsigned<Int>::type;
+
+    if (base < 2 || base > 36) { return {first, NumericError::InvalidArgument}; }
+
+    const char* p = first;
+    bool negative = false;
+    if (std::is_signed<Int>::value && p < last && *p == '-') {
+        negative = true;
+        ++p;
+    }
+
+    const Unsigned limit = negative
+        ? static_cast<Unsigned>(static_cast<Unsigned>(std::numeric_limits<Int>::max()) + 1U)
+        : static_cast<Unsigned>(std::numeric_limits<Int>::max());
+    const Unsigned ubase = static_cast<Unsigned>(base);
+
+    Unsigned acc = 0;
+    bool overflow = false;
+    const char* digitsStart = p;
+    for (; p < last; ++p) {
+        const int d = numeric_text_detail::DigitValue(*p);
+        if (d >= base) { break; }
+        if (acc > (limit - static_cast<Unsigned>(d)) / ubase) { overflow = true; }
+        acc = static_cast<Unsigned>(acc * ubase + static_cast<Unsigned>(d));
+    }
+
+    if (p == digitsStart) { return {first, NumericError::InvalidArgument}; }
+    if (overflow) { return {p, NumericError::OutOfRange}; }
+    value = negative ? static_cast<Int>(Unsigned(0) - acc) : static_cast<Int>(acc);
+    return {p, NumericError::None};
+}
+
+/**
+ * @brief Write `value` in base 10 to `[first, last)` (no terminator).
+ *
+ * @return `ptr` one past the last digit; `ValueTooLarge` (ptr = last) if it does not fit.
+ */
+template <typename Int>
+ToCharsResult FormatInteger(char* first, char* last, Int value) noexcept
+{
+    static_assert(std::is_integral<Int>::value, "FormatInteger requires an integral type.");
+    using Unsigned = typename std::make_unsigned<Int>::type;
+
+    char buffer[24];
+    char* end = buffer + sizeof(buffer);
+    char* p = end;
+
+    Unsigned u = static_cast<Unsigned>(value);
+    const bool negative = std::is_signed<Int>::value && value < 0;
+    if (negative) { u = static_cast<Unsigned>(Unsigned(0) - u); }
+
+    while (u >= 100U) {
+        const unsigned pair = static_cast<unsigned>(u % 100U) * 2U;
+        u = static_cast<Unsigned>(u / 100U);
+        *--p = numeric_text_detail::kDigitPairs[pair + 1U];
+        *--p = numeric_text_detail::kDigitPairs[pair];
+    }
+    if (u >= 10U) {
+        const unsigned pair = static_cast<unsigned>(u) * 2U;
+        *--p = numeric_text_detail::kDigitPairs[pair + 1U];
+        *--p = numeric_text_detail::kDigitPairs[pair];
+    } else {
+        *--p = static_cast<char>('0' + static_cast<unsigned>(u));
+    }
+    if (negative) { *--p = '-'; }
+
+    const size_t length = static_cast<size_t>(end - p);
+    if (static_cast<size_t>(last - first) < length) { return {last, NumericError::ValueTooLarge}; }
+    for (size_t i = 0; i < length; ++i) { first[i] = p[i]; }
+    return {first + length, NumericError::None};
+}
+
+//==============================================================//
+/// FLOATING POINT
+//==============================================================//
+
+namespace numeric_text_detail {
+
+/// Exactly representable powers of ten for the exact fast path
+constexpr double kExactPow10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+constexpr bool MatchesWord(const char* p, const char* last, const char* word) noexcept
+{
+    for (; *word != '\0'; ++word, ++p) {
+        if (p >= last || (*p | 0x20) != *word) { return false; }
+    }
+    return true;
+}
+
+/// 5^0 .. 5^13, the powers of five that fit a 32-bit limb multiplier
+constexpr uint32_t kPow5[] = {
+    1U, 5U, 25U, 125U, 625U, 3125U, 15625U, 78125U, 390625U, 1953125U, 9765625U, 48828125U,
+    244140625U, 1220703125U,
+};
+
+/// Significant decimal digits kept by the exact parse; every halfway point between
+/// two doubles has at most 767, so later digits only matter as a sticky bit
+constexpr int kMaxExactDigits = 768;
+
+/**
+ * @brief Fixed-capacity unsigned big integer (little-endian 32-bit limbs)
+ *        for the exact decimal <-> binary comparisons.
+ *
+ * Sized for the largest operand the comparisons build: 768 decimal digits,
+ * or a 55-bit binary mantissa times 5^1091 (about 2600 bits).
+ */
+class BigUnsigned {
+public:
+    static constexpr size_t kLimbs = 84;
+
+    explicit BigUnsigned(uint64_t value = 0) noexcept
+    {
+        size_ = 0;
+        for (; value != 0U; value >>= 32) { limbs_[size_++] = static_cast<uint32_t>(value); }
+    }
+
+    /// this = this * mul + add
+    void MulAdd(uint32_t mul, uint32_t add) noexcept
+    {
+        uint64_t carry = add;
+        for (size_t i = 0; i < size_; ++i) {
+            const uint64_t t = static_cast<uint64_t>(limbs_[i]) * mul + carry;
+            limbs_[i] = static_cast<uint32_t>(t);
+            carry = t >> 32;
+        }
+        if (carry != 0U && size_ < kLimbs) { limbs_[size_++] = static_cast<uint32_t>(carry); }
+    }
+
+    void MulPow5(int exponent) noexcept
+    {
+        for (; exponent >= 13; exponent -= 13) { MulAdd(kPow5[13], 0U); }
+        if (exponent > 0) { MulAdd(kPow5[exponent], 0U); }
+    }
+
+    size_t BitLength() const noexcept
+    {
+        if (size_ == 0U) { return 0U; }
+        size_t bits = (size_ - 1U) * 32U;
+        for (uint32_t top = limbs_[size_ - 1U]; top != 0U; top >>= 1) { ++bits; }
+        return bits;
+    }
+
+    /**
+     * @brief Sign of `a * 2^shift - b`.
+     */
+    static int CompareShifted(const BigUnsigned& a, size_t shift, const BigUnsigned& b) noexcept
+    {
+        const size_t aBits = (a.size_ == 0U) ? 0U : a.BitLength() + shift;
+        const size_t bBits = b.BitLength();
+        if (aBits != bBits) { return (aBits > bBits) ? 1 : -1; }
+        for (size_t i = (bBits + 31U) / 32U; i-- > 0U; ) {
+            const uint32_t x = a.ShiftedLimb(i, shift);
+            const uint32_t y = (i < b.size_) ? b.limbs_[i] : 0U;
+            if (x != y) { return (x > y) ? 1 : -1; }
+        }
+        return 0;
+    }
+
+private:
+    /// Limb `i` of `this * 2^shift`
+    uint32_t ShiftedLimb(size_t i, size_t shift) const noexcept
+    {
+        const size_t words = shift / 32U;
+        const unsigned bits = static_cast<unsigned>(shift % 32U);
+        if (i < words) { return 0U; }
+        const size_t j = i - words;
+        const uint32_t high = (j < size_) ? limbs_[j] : 0U;
+        if (bits == 0U) { return high; }
+        const uint32_t low = (j >= 1U && j - 1U < size_) ? limbs_[j - 1U] : 0U;
+        return (high << bits) | (low >> (32U - bits));
+    }
+
+    uint32_t limbs_[kLimbs];
+    size_t   size_;
+};
+
+/**
+ * @brief Sign of `decimal * 10^exp10 - binary * 2^exp2`, computed exactly.
+ */
+inline int CompareDecimalToBinary(const BigUnsigned& decimal, int exp10, uint64_t binary, int exp2) noexcept
+{
+    // decimal * 5^exp10 * 2^exp10 vs binary * 2^exp2; a negative exp10 moves 5^-exp10 to the right.
+    BigUnsigned b(binary);
+    const int shift = exp10 - exp2;
+    if (exp10 >= 0) {
+        BigUnsigned a = decimal;
+        a.MulPow5(exp10);
+        return (shift >= 0) ? BigUnsigned::CompareShifted(a, size_t(shift), b)
+                            : -BigUnsigned::CompareShifted(b, size_t(-shift), a);
+    }
+    b.MulPow5(-exp10);
+    return (shift >= 0) ? BigUnsigned::CompareShifted(decimal, size_t(shift), b)
+                        : -BigUnsigned::CompareShifted(b, size_t(-shift), decimal);
+}
+
+/**
+ * @brief Split a finite non-negative `float` / `double` into `mantissa * 2^exp2`
+ *        with an integer mantissa below 2^digits; infinity maps to 2^max_exponent
+ *        (2^1024 or 2^128).
+ */
+template <typename T>
+inline void DecomposeFloat(T value, uint64_t& mantissa, int& exp2) noexcept
+{
+    constexpr int kDigits = std::numeric_limits<T>::digits;
+    constexpr int kMinExp2 = std::numeric_limits<T>::min_exponent - kDigits;   ///< Subnormal ulp exponent
+    if (std::isinf(value)) {
+        mantissa = uint64_t{1} << (kDigits - 1);
+        exp2 = std::numeric_limits<T>::max_exponent - (kDigits - 1);
+        return;
+    }
+    if (value == T(0)) {
+        mantissa = 0U;
+        exp2 = kMinExp2;
+        return;
+    }
+    int e = 0;
+    (void)std::frexp(value, &e);
+    exp2 = (e - kDigits < kMinExp2) ? kMinExp2 : e - kDigits;
+    mantissa = static_cast<uint64_t>(std::ldexp(value, -exp2));
+}
+
+/**
+ * @brief Midpoint of adjacent values `low < high` as `half * 2^exp2` (exact).
+ */
+template <typename T>
+inline void HalfwayPoint(T low, T high, uint64_t& half, int& exp2) noexcept
+{
+    uint64_t lowMantissa = 0, highMantissa = 0;
+    int lowExp = 0, highExp = 0;
+    DecomposeFloat(low, lowMantissa, lowExp);
+    DecomposeFloat(high, highMantissa, highExp);
+    const int e = (lowExp < highExp) ? lowExp : highExp;
+    half = (lowMantissa << (lowExp - e)) + (highMantissa << (highExp - e));
+    exp2 = e - 1;
+}
+
+template <typename T>
+inline bool MantissaIsOdd(T value) noexcept
+{
+    uint64_t mantissa = 0;
+    int exp2 = 0;
+    DecomposeFloat(value, mantissa, exp2);
+    return (mantissa & 1U) != 0U;
+}
+
+/**
+ * @brief `value * 10^exp10` to within a few ulps, without intermediate
+ *        overflow or underflow: powers of ten are applied in exact 10^22
+ *        steps on a frexp-normalised mantissa. Starting point for the exact
+ *        corrections below.
+ */
+inline double ApproxScaleByPow10(double value, int exp10) noexcept
+{
+    int exp2 = 0;
+    int e = 0;
+    value = std::frexp(value, &exp2);
+    for (; exp10 >= 22; exp10 -= 22) { value = std::frexp(value * kExactPow10[22], &e); exp2 += e; }
+    for (; exp10 <= -22; exp10 += 22) { value = std::frexp(value / kExactPow10[22], &e); exp2 += e; }
+    value = (exp10 >= 0) ? value * kExactPow10[exp10] : value / kExactPow10[-exp10];
+    return std::ldexp(value, exp2);
+}
+
+/**
+ * @brief Correctly rounded (half-even) `float` / `double` nearest
+ *        `digits * 10^exp10`, plus a sticky fraction when `inexact`, starting
+ *        from `estimate`. Rounds once, straight to `T`'s precision.
+ * @return False if the result overflows.
+ */
+template <typename T>
+inline bool RoundDecimalToFloat(const BigUnsigned& digits, int exp10, bool inexact, T estimate, T& result) noexcept
+{
+    constexpr T kMax = std::numeric_limits<T>::max();
+    T b = (std::isinf(estimate) || estimate > kMax) ? kMax : estimate;
+    uint64_t half = 0;
+    int exp2 = 0;
+    for (;;) {
+        const T up = std::nextafter(b, std::numeric_limits<T>::infinity());
+        HalfwayPoint(b, up, half, exp2);
+        int c = CompareDecimalToBinary(digits, exp10, half, exp2);
+        if (c == 0 && inexact) { c = 1; }
+        if (c > 0 || (c == 0 && MantissaIsOdd(b))) {
+            if (std::isinf(up)) { return false; }
+            b = up;
+            continue;
+        }
+        if (b == T(0)) { break; }
+        const T down = std::nextafter(b, T(0));
+        HalfwayPoint(down, b, half, exp2);
+        c = CompareDecimalToBinary(digits, exp10, half, exp2);
+        if (c == 0 && inexact) { c = 1; }
+        if (c < 0 || (c == 0 && MantissaIsOdd(b))) {
+            b = down;
+            continue;
+        }
+        break;
+    }
+    result = b;
+    return true;
+}
+
+/**
+ * @brief Exact decimal digits of `[first, last)` (digits and at most one `.`)
+ *        as `digits * 10^exp10`; digits past `kMaxExactDigits` only set `inexact`.
+ */
+inline void ReadExactDecimal(const char* first, const char* last, BigUnsigned& digits, int& exp10,
+                             bool& inexact) noexcept
+{
+    int kept = 0;
+    bool fraction = false;
+    uint32_t chunk = 0;
+    uint32_t chunkScale = 1;
+    exp10 = 0;
+    inexact = false;
+    for (const char* p = first; p < last; ++p) {
+        if (*p == '.') { fraction = true; continue; }
+        const uint32_t d = static_cast<uint32_t>(*p - '0');
+        if (kept < kMaxExactDigits) {
+            if (kept != 0 || d != 0U) { ++kept; }
+            chunk = chunk * 10U + d;
+            chunkScale *= 10U;
+            if (chunkScale == 1000000000U) {
+                digits.MulAdd(chunkScale, chunk);
+                chunk = 0;
+                chunkScale = 1;
+            }
+            if (fraction) { --exp10; }
+        } else {
+            inexact = inexact || d != 0U;
+            if (!fraction) { ++exp10; }
+        }
+    }
+    if (chunkScale != 1U) { digits.MulAdd(chunkScale, chunk); }
+}
+
+/// Clinger fast-path limits: integers below 2^digits and the powers of ten exact in `T`
+template <typename T> struct FastPathLimits;
+template <> struct FastPathLimits<double> { static constexpr int kMaxPow10 = 22; };
+template <> struct FastPathLimits<float>  { static constexpr int kMaxPow10 = 10; };
+
+/**
+ * @brief `float` from `mantissa * 10^exp10` (mantissa <= 2^53, |exp10| <= 22) via one
+ *        correctly rounded `double` operation.
+ *
+ * Rounding that double to float again can only differ from rounding the exact value
+ * when the double lands exactly on a float midpoint (every float midpoint is itself a
+ * double, so none can lie strictly between the exact value and its nearest double).
+ * @return False for that case, and near the overflow threshold; the caller takes the exact path.
+ */
+inline bool FloatViaExactDouble(uint64_t mantissa, int exp10, float& result) noexcept
+{
+    const double m = static_cast<double>(mantissa);
+    const double d = (exp10 < 0) ? m / kExactPow10[-exp10] : m * kExactPow10[exp10];
+    const float f = static_cast<float>(d);
+    const float neighbour = std::nextafter(f, (d > static_cast<double>(f)) ? HUGE_VALF : 0.0f);
+    if (std::isinf(f) || std::isinf(neighbour)) { return false; }
+    if (d == (static_cast<double>(f) + static_cast<double>(neighbour)) / 2.0) { return false; }
+    result = f;
+    return true;
+}
+
+/**
+ * @brief Parse straight to `float` or `double`, rounding once to the target precision.
+ */
+template <typename T>
+inline FromCharsResult ParseDecimal(const char* first, const char* last, T& value) noexcept
+{
+    constexpr T kInfinity = std::numeric_limits<T>::infinity();
+    constexpr int kMaxPow10 = FastPathLimits<T>::kMaxPow10;
+    const char* p = first;
+    const bool negative = (p < last && *p == '-');
+    if (negative) { ++p; }
+
+    if (MatchesWord(p, last, "inf")) {
+        p += MatchesWord(p, last, "infinity") ? 8 : 3;
+        value = negative ? -kInfinity : kInfinity;
+        return {p, NumericError::None};
+    }
+    if (MatchesWord(p, last, "nan")) {
+        value = negative ? -std::numeric_limits<T>::quiet_NaN() : std::numeric_limits<T>::quiet_NaN();
+        return {p + 3, NumericError::None};
+    }
+
+    uint64_t mantissa = 0;
+    int significant = 0;  ///< digits accumulated in `mantissa`
+    int exp10 = 0;
+    bool anyDigit = false;
+    bool truncated = false;  ///< a non-zero digit did not fit in `mantissa`
+    const char* digitsFirst = p;
+
+    for (; p < last && *p >= '0' && *p <= '9'; ++p) {
+        anyDigit = true;
+        if (significant < 19) {
+            mantissa = mantissa * 10U + static_cast<uint64_t>(*p - '0');
+            if (mantissa != 0U) { ++significant; }
+        } else {
+            ++exp10;
+            truncated = truncated || *p != '0';
+        }
+    }
+    if (p < last && *p == '.') {
+        ++p;
+        for (; p < last && *p >= '0' && *p <= '9'; ++p) {
+            anyDigit = true;
+            if (significant < 19) {
+                mantissa = mantissa * 10U + static_cast<uint64_t>(*p - '0');
+                if (mantissa != 0U) { ++significant; }
+                --exp10;
+            } else {
+                truncated = truncated || *p != '0';
+            }
+        }
+    }
+    if (!anyDigit) { return {first, NumericError::InvalidArgument}; }
+    const char* digitsLast = p;
+
+    int exponent = 0;
+    if (p < last && (*p == 'e' || *p == 'E')) {
+        const char* q = p + 1;
+        bool expNegative = false;
+        if (q < last && (*q == '-' || *q == '+')) {
+            expNegative = (*q == '-');
+            ++q;
+        }
+        if (q < last && *q >= '0' && *q <= '9') {
+            int e = 0;
+            for (; q < last && *q >= '0' && *q <= '9'; ++q) {
+                if (e < 100000) { e = e * 10 + (*q - '0'); }
+            }
+            exponent = expNegative ? -e : e;
+            p = q;
+        }
+    }
+    exp10 += exponent;
+
+    if (mantissa == 0U) {
+        value = negative ? -T(0) : T(0);
+        return {p, NumericError::None};
+    }
+
+    /// Decimal magnitude of the leading digit decides range before any arithmetic
+    const int magnitude = exp10 + significant - 1;
+    if (magnitude > std::numeric_limits<T>::max_exponent10) { return {p, NumericError::OutOfRange}; }
+    if (magnitude < std::numeric_limits<T>::min_exponent10 - std::numeric_limits<T>::max_digits10) {
+        return {p, NumericError::OutOfRange};
+    }
+
+    T result = T(0);
+    bool settled = false;
+    if (!truncated && mantissa <= (uint64_t{1} << std::numeric_limits<T>::digits)
+        && exp10 >= -kMaxPow10 && exp10 <= kMaxPow10) {
+        /// Clinger fast path: both operands exact in T, so one correctly rounded T operation
+        const T m = static_cast<T>(mantissa);
+        const T scale = static_cast<T>(kExactPow10[exp10 < 0 ? -exp10 : exp10]);
+        result = (exp10 < 0) ? m / scale : m * scale;
+        settled = true;
+    } else if constexpr (std::is_same<T, float>::value) {
+        if (!truncated && mantissa <= (uint64_t{1} << 53) && exp10 >= -22 && exp10 <= 22) {
+            settled = FloatViaExactDouble(mantissa, exp10, result);
+        }
+    }
+    if (!settled) {
+        /// Estimate, then settle the last bit by exact comparison with the neighbouring halfway points
+        BigUnsigned digits;
+        int digitsExp10 = 0;
+        bool inexact = false;
+        ReadExactDecimal(digitsFirst, digitsLast, digits, digitsExp10, inexact);
+        const T estimate = static_cast<T>(ApproxScaleByPow10(static_cast<double>(mantissa), exp10));
+        if (!RoundDecimalToFloat(digits, digitsExp10 + exponent, inexact, estimate, result)) {
+            return {p, NumericError::OutOfRange};
+        }
+    }
+    if (std::isinf(result) || result == T(0)) { return {p, NumericError::OutOfRange}; }
+
+    value = negative ? -result : result;
+    return {p, NumericError::None};
+}
+
+/**
+ * @brief Write `value` with `digits` significant digits (`%g`-style layout).
+ */
+inline ToCharsResult FormatDouble(char* first, char* last, double value, int digits) noexcept
+{
+    char buffer[40];
+    char* out = buffer;
+
+    if (std::signbit(value)) { *out++ = '-'; }
+    if (std::isnan(value)) {
+        out = buffer;
+        *out++ = 'n'; *out++ = 'a'; *out++ = 'n';
+    } else if (std::isinf(value)) {
+        *out++ = 'i'; *out++ = 'n'; *out++ = 'f';
+    } else if (value == 0.0) {
+        *out++ = '0';
+    } else {
+        const double v = std::fabs(value);
+        uint64_t binary = 0;
+        int exp2 = 0;
+        DecomposeFloat(v, binary, exp2);
+        int e10 = static_cast<int>(std::floor(std::log10(v)));
+
+        uint64_t lower = 1;
+        for (int i = 1; i < digits; ++i) { lower *= 10U; }
+        const uint64_t upper = lower * 10U;
+
+        uint64_t mantissa = 0;
+        for (int attempt = 0; attempt < 3; ++attempt) {
+            /// Estimate round(v * 10^scale), then correct it against the exact value: v lies
+            /// in [mantissa - 1/2, mantissa + 1/2] * 10^-scale, ties to the even mantissa.
+            const int scale = digits - 1 - e10;
+            mantissa = static_cast<uint64_t>(std::llround(ApproxScaleByPow10(v, scale)));
+            for (;;) {
+                const int above = CompareDecimalToBinary(BigUnsigned(2U * mantissa + 1U), -scale, binary, exp2 + 1);
+                if (above < 0 || (above == 0 && (mantissa & 1U) != 0U)) { ++mantissa; continue; }
+                if (mantissa == 0U) { break; }
+                const int below = CompareDecimalToBinary(BigUnsigned(2U * mantissa - 1U), -scale, binary, exp2 + 1);
+                if (below > 0 || (below == 0 && (mantissa & 1U) != 0U)) { --mantissa; continue; }
+                break;
+            }
+            /// log10 can be off by one near powers of ten; rounding can also carry into a new digit
+            if (mantissa >= upper) {
+                ++e10;
+            } else if (mantissa < lower) {
+                --e10;
+            } else {
+                break;
+            }
+        }
+
+        char digitText[20];
+        for (int i = digits - 1; i >= 0; --i) {
+            digitText[i] = static_cast<char>('0' + mantissa % 10U);
+            mantissa /= 10U;
+        }
+        int count = digits;
+        while (count > 1 && digitText[count - 1] == '0') { --count; }
+
+        if (e10 >= -5 && e10 < digits) {
+            if (e10 >= 0) {
+                for (int i = 0; i <= e10; ++i) { *out++ = (i < count) ? digitText[i] : '0'; }
+                if (count > e10 + 1) {
+                    *out++ = '.';
+                    for (int i = e10 + 1; i < count; ++i) { *out++ = digitText[i]; }
+                }
+            } else {
+                *out++ = '0';
+                *out++ = '.';
+                for (int i = -1; i > e10; --i) { *out++ = '0'; }
+                for (int i = 0; i < count; ++i) { *out++ = digitText[i]; }
+            }
+        } else {
+            *out++ = digitText[0];
+            if (count > 1) {
+                *out++ = '.';
+                for (int i = 1; i < count; ++i) { *out++ = digitText[i]; }
+            }
+            *out++ = 'e';
+            *out++ = (e10 < 0) ? '-' : '+';
+            const int absExp = (e10 < 0) ? -e10 : e10;
+            if (absExp >= 100) { *out++ = static_cast<char>('0' + absExp / 100); }
+            *out++ = static_cast<char>('0' + (absExp / 10) % 10);
+            *out++ = static_cast<char>('0' + absExp % 10);
+        }
+    }
+
+    const size_t length = static_cast<size_t>(out - buffer);
+    if (static_cast<size_t>(last - first) < length) { return {last, NumericError::ValueTooLarge}; }
+    for (size_t i = 0; i < length; ++i) { first[i] = buffer[i]; }
+    return {first + length, NumericError::None};
+}
+
+} // namespace numeric_text_detail
+
+/**
+ * @brief Parse a `double` from `[first, last)`.
+ *
+ * Grammar: `[-](digits[.digits]|.digits)[(e|E)[+|-]digits]`, or `inf`,
+ * `infinity`, `nan` (case-insensitive). On error `value` is left unchanged.
+ */
+inline FromCharsResult ParseFloat(const char* first, const char* last, double& value) noexcept
+{
+    return numeric_text_detail::ParseDecimal(first, last, value);
+}
+
+/// @copydoc ParseFloat(const char*, const char*, double&)
+inline FromCharsResult ParseFloat(const char* first, const char* last, float& value) noexcept
+{
+    return numeric_text_detail::ParseDecimal(first, last, value);
+}
+
+/**
+ * @brief Write a `double` to `[first, last)` (no terminator).
+ *
+ * @param significantDigits 1..17; the default 17 always round-trips.
+ */
+inline ToCharsResult FormatFloat(char* first, char* last, double value, int significantDigits = 17) noexcept
+{
+    const int digits = (significantDigits < 1) ? 1 : (significantDigits > 17 ? 17 : significantDigits);
+    return numeric_text_detail::FormatDouble(first, last, value, digits);
+}
+
+/**
+ * @brief Write a `float` to `[first, last)` (no terminator).
+ *
+ * @param significantDigits 1..9; the default 9 always round-trips.
+ */
+inline ToCharsResult FormatFloat(char* first, char* last, float value, int significantDigits = 9) noexcept
+{
+    const int digits = (significantDigits < 1) ? 1 : (significantDigits > 9 ? 9 : significantDigits);
+    return numeric_text_detail::FormatDouble(first, last, static_cast<double>(value), digits);
+}
+
+//==============================================================//
+/// FIELDS AND LINES
+//==============================================================//
+
+/**
+ * @brief Parse a whole field (surrounding whitespace ignored) as `T`.
+ *
+ * @return True only if the entire trimmed field is one valid number.
+ */
+template <typename T>
+bool ParseValue(std::string_view field, T& value) noexcept
+{
+    field = StringTrimView(field);
+    const char* first = field.data();
+    const char* last = first + field.size();
+    FromCharsResult r{};
+    if constexpr (std::is_floating_point<T>::value) {
+        r = ParseFloat(first, last, value);
+    } else {
+        r = ParseInteger(first, last, value);
+    }
+    return r.error == NumericError::None && r.ptr == last;
+}
+
+/**
+ * @brief Result of `ParseCsvLine()`.
+ */
+struct CsvParseResult {
+    size_t       count;  ///< Fields stored in the output array.
+    NumericError error;  ///< `None`, or the error of the first bad field.
+};
+
+/**
+ * @brief Parse a delimited line of numbers into `out[0..capacity)`.
+ *
+ * Fields are trimmed. Parsing stops at the first field that is not a
+ * number of type `T` (`InvalidArgument`) or when more fields than
+ * `capacity` are present (`ValueTooLarge`); `count` is the number of fields
+ * stored before that point.
+ */
+template <typename T>
+CsvParseResult ParseCsvLine(std::string_view line, T* out, size_t capacity, char delimiter = ',') noexcept
+{
+    size_t count = 0;
+    for (std::string_view field : StringSplitView(line, delimiter)) {
+        if (count == capacity) { return {count, NumericError::ValueTooLarge}; }
+        T parsed{};
+        if (!ParseValue(field, parsed)) { return {count, NumericError::InvalidArgument}; }
+        out[count++] = parsed;
+    }
+    return {count, NumericError::None};
+}
+
+/**
+ * @brief Split `key<separator>value`, trimming both parts.
+ *
+ * @return False if `separator` is missing or the key is empty.
+ */
+inline bool SplitKeyValue(std::string_view field, std::string_view& key, std::string_view& value,
+                          char separator = '=') noexcept
+{
+    const size_t at = FindChar(field, separator);
+    if (at == std::string_view::npos) { return false; }
+    key = StringTrimView(field.substr(0, at));
+    value = StringTrimView(field.substr(at + 1U));
+    return !key.empty();
+}
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_NUMERICTEXT_H_ */
@@ -0,0 +1,326 @@
+/**
+ * @file PeriodicTaskManager.h
+ * @brief Fixed-size periodic task scheduler with earliest-deadline-first or
+ *        rate-monotonic dispatch and per-task deadline accounting.
+ *
+ * Companion to `TaskManager` for jobs that recur on a fixed period. Instead
+ * of every predicate re-implementing "has 10 ms elapsed" with
+ * `GetElapsedTimeMsec()`, each `PeriodicTask` declares its period, relative
+ * deadline, and release offset once; the manager keeps:
+ * - a **release heap** of idle tasks ordered by next release time, and
+ * - a **ready heap** of released jobs ordered by absolute deadline (EDF) or
+ *   by period (RM, shorter period = higher priority).
+ *
+ * Every scheduling decision is a heap pop/push, O(log N). Each task has at
+ * most one outstanding job; releases that come due while its job is still
+ * waiting or running are skipped and counted rather than queued, so the next
+ * release is always after the job completes.
+ *
+ * ### Threading and allocation
+ * - No allocation after construction; heaps live in `std::array`.
+ * - Single owner: all calls must come from the scheduling task.
+ * - Timing uses a `uint32_t` millisecond clock (wrap-safe comparisons);
+ *   defaults to `GetElapsedTimeMsec()` and may be replaced for testing.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_PERIODICTASKMANAGER_H_
+#define HF_UTILS_GENERAL_PERIODICTASKMANAGER_H_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "Utility.h"
+
+namespace hf_utils {
+
+/**
+ * @brief Dispatch order among released jobs.
+ */
+enum class PeriodicPolicy : uint8_t {
+    EarliestDeadlineFirst = 0, ///< Smallest absolute deadline runs first.
+    RateMonotonic         = 1, ///< Shortest period runs first (static priority).
+};
+
+/**
+ * @brief Static description of one periodic task.
+ */
+struct PeriodicTask {
+    uint32_t period_ms{0};            ///< Release period in ms (must be > 0).
+    uint32_t deadline_ms{0};          ///< Relative deadline in ms; `0` = implicit (equal to period).
+    uint32_t offset_ms{0};            ///< First release, relative to `Start()`.
+    std::function<void()> execute;    ///< Job body.
+};
+
+/**
+ * @brief Per-task deadline / lateness counters.
+ *
+ * Lateness is `completion - absolute deadline`, clamped at zero.
+ */
+struct PeriodicTaskStats {
+    uint32_t releases{0};          ///< Jobs released.
+    uint32_t completions{0};       ///< Jobs executed to completion.
+    uint32_t deadline_misses{0};   ///< Jobs that completed after their deadline.
+    uint32_t skipped_releases{0};  ///< Releases dropped because the previous job was still pending.
+    uint32_t last_lateness_ms{0};  ///< Lateness of the most recent job.
+    uint32_t max_lateness_ms{0};   ///< Worst lateness observed.
+    uint64_t total_lateness_ms{0}; ///< Sum of lateness over all completed jobs.
+};
+
+/**
+ * @brief Periodic scheduler over `N` tasks.
+ *
+ * Typical owner loop:
+ * \code{.cpp}
+ * scheduler.Start(GetElapsedTimeMsec());
+ * for (;;) {
+ *     scheduler.RunAllDue();
+ *     SleepMs(scheduler.MsUntilNextRelease()); // owner's RTOS / host sleep
+ * }
+ * \endcode
+ *
+ * @tparam N Number of periodic tasks.
+ */
+template <size_t N>
+class PeriodicTaskManager {
+public:
+    static_assert(N > 0, "PeriodicTaskManager requires at least one task.");
+    static_assert(N <= 0xFFFFU, "PeriodicTaskManager indexes tasks with uint16_t.");
+
+    /// Millisecond time source.
+    using ClockFn = uint32_t (*)();
+
+    /**
+     * @brief Construct the scheduler; call `Start()` before running.
+     *
+     * @param tasksArg Task table; indices are used by `GetStats()`.
+     * @param policy   Ready-queue ordering.
+     * @param clock    Millisecond time source.
+     */
+    PeriodicTaskManager(const std::array<PeriodicTask, N>& tasksArg,
+                        PeriodicPolicy policy = PeriodicPolicy::EarliestDeadlineFirst,
+                        ClockFn clock = &GetElapsedTimeMsec) noexcept
+        : tasks_(tasksArg)
+        , policy_(policy)
+        , clock_(clock)
+    {
+        for (auto& task : tasks_) {
+            if (task.period_ms == 0U)   { task.period_ms = 1U; }
+            if (task.deadline_ms == 0U) { task.deadline_ms = task.period_ms; }
+        }
+    }
+
+    PeriodicTaskManager(const PeriodicTaskManager&)            = delete;
+    PeriodicTaskManager& operator=(const PeriodicTaskManager&) = delete;
+
+    /**
+     * @brief Arm every task relative to `now_ms` and clear the job queues.
+     *
+     * Statistics are preserved; use `ResetStats()` to clear them.
+     *
+     * @param now_ms Reference time for the release offsets.
+     */
+    void Start(uint32_t now_ms) noexcept
+    {
+        releaseCount_ = 0;
+        readyCount_   = 0;
+        for (size_t i = 0; i < N; ++i) {
+            nextRelease_[i] = now_ms + tasks_[i].offset_ms;
+            PushRelease(static_cast<uint16_t>(i));
+        }
+        started_ = true;
+    }
+
+    /**
+     * @brief Release every job that is due and execute the highest-priority one.
+     *
+     * @return True if a job was executed.
+     */
+    bool RunNext() noexcept
+    {
+        if (!started_) { return false; }
+        ReleaseDue(clock_());
+        if (readyCount_ == 0U) { return false; }
+
+        const uint16_t index = PopReady();
+        tasks_[index].execute();
+        Complete(index, clock_());
+        return true;
+    }
+
+    /**
+     * @brief Run jobs until none are ready, at most `N` per call.
+     *
+     * The cap keeps an overloaded task set (total runtime above its periods)
+     * from holding the caller here forever; anything still due is picked up
+     * by the next call.
+     *
+     * @return Number of jobs executed.
+     */
+    uint32_t RunAllDue() noexcept
+    {
+        uint32_t executed = 0;
+        while (executed < N && RunNext()) { ++executed; }
+        return executed;
+    }
+
+    /**
+     * @brief Time until the earliest pending release.
+     *
+     * @return `0` if a job is ready or already due; otherwise the number of
+     *         ms the owner may sleep before calling `RunNext()` again.
+     */
+    uint32_t MsUntilNextRelease() const noexcept
+    {
+        if (!started_ || readyCount_ != 0U || releaseCount_ == 0U) { return 0U; }
+        const int32_t delta = static_cast<int32_t>(nextRelease_[releaseHeap_[0]] - clock_());
+        return (delta > 0) ? static_cast<uint32_t>(delta) : 0U;
+    }
+
+    /// @return Number of released jobs waiting to run.
+    size_t ReadyCount() const noexcept { return readyCount_; }
+
+    /// @return Counters for task `index` (zeroed snapshot if out of range).
+    PeriodicTaskStats GetStats(size_t index) const noexcept
+    {
+        return (index < N) ? stats_[index] : PeriodicTaskStats{};
+    }
+
+    /// @return Total deadline misses across all tasks.
+    uint32_t TotalDeadlineMisses() const noexcept
+    {
+        uint32_t total = 0;
+        for (const auto& s : stats_) { total += s.deadline_misses; }
+        return total;
+    }
+
+    /// @brief Zero every task's counters.
+    void ResetStats() noexcept
+    {
+        for (auto& s : stats_) { s = PeriodicTaskStats{}; }
+    }
+
+private:
+    /// Wrap-safe `a < b` on the millisecond clock.
+    static bool Before(uint32_t a, uint32_t b) noexcept
+    {
+        return static_cast<int32_t>(a - b) < 0;
+    }
+
+    //==============================================================//
+    /// HEAP ORDERING (std::*_heap builds max-heaps, so "less" = later)
+    //==============================================================//
+
+    bool ReleasesAfter(uint16_t a, uint16_t b) const noexcept
+    {
+        if (nextRelease_[a] != nextRelease_[b]) {
+            return Before(nextRelease_[b], nextRelease_[a]);
+        }
+        return a > b;
+    }
+
+    bool RunsAfter(uint16_t a, uint16_t b) const noexcept
+    {
+        if (policy_ == PeriodicPolicy::EarliestDeadlineFirst) {
+            if (absDeadline_[a] != absDeadline_[b]) {
+                return Before(absDeadline_[b], absDeadline_[a]);
+            }
+        } else if (tasks_[a].period_ms != tasks_[b].period_ms) {
+            return tasks_[a].period_ms > tasks_[b].period_ms;
+        }
+        return a > b;
+    }
+
+    void PushRelease(uint16_t index) noexcept
+    {
+        releaseHeap_[releaseCount_++] = index;
+        std::push_heap(releaseHeap_.begin(), releaseHeap_.begin() + releaseCount_,
+                       [this](uint16_t a, uint16_t b) { return ReleasesAfter(a, b); });
+    }
+
+    uint16_t PopRelease() noexcept
+    {
+        std::pop_heap(releaseHeap_.begin(), releaseHeap_.begin() + releaseCount_,
+                      [this](uint16_t a, uint16_t b) { return ReleasesAfter(a, b); });
+        return releaseHeap_[--releaseCount_];
+    }
+
+    void PushReady(uint16_t index) noexcept
+    {
+        readyHeap_[readyCount_++] = index;
+        std::push_heap(readyHeap_.begin(), readyHeap_.begin() + readyCount_,
+                       [this](uint16_t a, uint16_t b) { return RunsAfter(a, b); });
+    }
+
+    uint16_t PopReady() noexcept
+    {
+        std::pop_heap(readyHeap_.begin(), readyHeap_.begin() + readyCount_,
+                      [this](uint16_t a, uint16_t b) { return RunsAfter(a, b); });
+        return readyHeap_[--readyCount_];
+    }
+
+    /**
+     * @brief Move every task whose release time has arrived to the ready heap.
+     */
+    void ReleaseDue(uint32_t now_ms) noexcept
+    {
+        while (releaseCount_ != 0U && !Before(now_ms, nextRelease_[releaseHeap_[0]])) {
+            const uint16_t index = PopRelease();
+            absDeadline_[index] = nextRelease_[index] + tasks_[index].deadline_ms;
+            ++stats_[index].releases;
+            PushReady(index);
+        }
+    }
+
+    /**
+     * @brief Record lateness for a finished job and schedule its next release.
+     */
+    void Complete(uint16_t index, uint32_t done_ms) noexcept
+    {
+        PeriodicTaskStats& s = stats_[index];
+        ++s.completions;
+
+        uint32_t lateness = 0;
+        if (Before(absDeadline_[index], done_ms)) {
+            lateness = done_ms - absDeadline_[index];
+            ++s.deadline_misses;
+        }
+        s.last_lateness_ms   = lateness;
+        s.max_lateness_ms    = std::max(s.max_lateness_ms, lateness);
+        s.total_lateness_ms += lateness;
+
+        /// Next release is one period after the last one; drop every release at or before done_ms,
+        /// since the job was still pending then (and a due release would make RunAllDue() spin)
+        const uint32_t period = tasks_[index].period_ms;
+        uint32_t next = nextRelease_[index] + period;
+        if (!Before(done_ms, next)) {
+            const uint32_t missed = (done_ms - next) / period + 1U;
+            s.skipped_releases += missed;
+            next += missed * period;
+        }
+        nextRelease_[index] = next;
+        PushRelease(index);
+    }
+
+    std::array<PeriodicTask, N> tasks_;
+    PeriodicPolicy              policy_;
+    ClockFn                     clock_;
+    bool                        started_{false};
+
+    std::array<uint32_t, N> nextRelease_{};
+    std::array<uint32_t, N> absDeadline_{};
+    std::array<PeriodicTaskStats, N> stats_{};
+
+    std::array<uint16_t, N> releaseHeap_{};
+    size_t                  releaseCount_{0};
+    std::array<uint16_t, N> readyHeap_{};
+    size_t                  readyCount_{0};
+};
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_PERIODICTASKMANAGER_H_ */
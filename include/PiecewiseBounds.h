@@ -6,6 +6,8 @@
 #ifndef HF_UTILS_GENERAL_PIECEWISEBOUNDS_H_
 #define HF_UTILS_GENERAL_PIECEWISEBOUNDS_H_
 
+#include <cstddef>
+
 #include "BoundedLinearCurve.h"
 #include "DynamicArray.h"
 #include "PiecewiseLinearCurve.h"
@@ -14,8 +16,9 @@
  * @brief Class to represent piecewise maximum and minimum bounds using multiple BoundedLinearCurve segments.
  * @tparam MaxMaxSegments The maximum number of segments allowed in the piecewise maximum bounds.
  * @tparam MaxMinSegments The maximum number of segments allowed in the piecewise minimum bounds.
+ * @tparam GridBuckets Uniform-grid buckets per bound curve for SegmentSearchMode::Grid (0 = no grid storage).
  */
-template <uint8_t MaxMaxSegments, uint8_t MaxMinSegments>
+template <uint8_t MaxMaxSegments, uint8_t MaxMinSegments, size_t GridBuckets = 0>
 class PiecewiseBounds {
 public:
     /**
@@ -44,6 +47,15 @@ public:
         return minSegments.AddSegment(segment);
     }
 
+    /**
+     * @brief Selects how both bound curves locate the segment for an input.
+     * @param mode The search mode (see PiecewiseBoundedLinearCurve).
+     */
+    void SetSearchMode(hf_utils::SegmentSearchMode mode) noexcept {
+        maxSegments.SetSearchMode(mode);
+        minSegments.SetSearchMode(mode);
+    }
+
     /**
      * @brief Calculates the maximum y value for a given x using the piecewise maximum bounds.
      * @param x The x value.
@@ -74,6 +86,95 @@ public:
         return false;
     }
 
+    /**
+     * @brief Calculates the maximum y value for a given x, starting from the segment found by the previous call.
+     * @param x The x value.
+     * @param y The reference to store the calculated y value.
+     * @param hint Caller-owned cache of the last maximum-bound segment.
+     * @return True if the calculation was successful, false otherwise.
+     */
+    bool CalculateMaxY(float x, float& y, hf_utils::SegmentHint& hint) const {
+        if (maxSegments.CalculateY(x, y, hint)) {
+            return true;
+        }
+        y = globalYMax;
+        return false;
+    }
+
+    /**
+     * @brief Calculates the minimum y value for a given x, starting from the segment found by the previous call.
+     * @param x The x value.
+     * @param y The reference to store the calculated y value.
+     * @param hint Caller-owned cache of the last minimum-bound segment.
+     * @return True if the calculation was successful, false otherwise.
+     */
+    bool CalculateMinY(float x, float& y, hf_utils::SegmentHint& hint) const {
+        if (minSegments.CalculateY(x, y, hint)) {
+            return true;
+        }
+        y = globalYMin;
+        return false;
+    }
+
+    /**
+     * @brief Calculates the maximum bound for every input of an array (globalYMax where out of range).
+     * @param x Input values.
+     * @param y Output values (may alias x).
+     * @param n Number of values.
+     * @return Number of inputs covered by a maximum-bound segment.
+     */
+    size_t CalculateMaxY(const float* x, float* y, size_t n) const noexcept {
+        return maxSegments.CalculateY(x, y, n, globalYMax);
+    }
+
+    /**
+     * @brief Calculates the minimum bound for every input of an array (globalYMin where out of range).
+     * @param x Input values.
+     * @param y Output values (may alias x).
+     * @param n Number of values.
+     * @return Number of inputs covered by a minimum-bound segment.
+     */
+    size_t CalculateMinY(const float* x, float* y, size_t n) const noexcept {
+        return minSegments.CalculateY(x, y, n, globalYMin);
+    }
+
+    /**
+     * @brief Clamps a value to the [minimum, maximum] bounds at x in one call.
+     * @param x The x value.
+     * @param value The value to clamp.
+     * @return The clamped value.
+     */
+    float Clamp(float x, float value) const noexcept {
+        float yMin = globalYMin;
+        float yMax = globalYMax;
+        CalculateMinY(x, yMin);
+        CalculateMaxY(x, yMax);
+        return value < yMin ? yMin : (value > yMax ? yMax : value);
+    }
+
+    /**
+     * @brief Clamps every value to the [minimum, maximum] bounds at its x, evaluating both bound curves
+     *        with the batch kernels chunk by chunk (no allocation).
+     * @param x Input x values.
+     * @param values Values to clamp.
+     * @param clamped Output values (may alias values).
+     * @param n Number of values.
+     */
+    void Clamp(const float* x, const float* values, float* clamped, size_t n) const noexcept {
+        constexpr size_t ChunkSize = 64;
+        float yMin[ChunkSize];
+        float yMax[ChunkSize];
+        for (size_t offset = 0; offset < n; offset += ChunkSize) {
+            const size_t count = (n - offset) < ChunkSize ? (n - offset) : ChunkSize;
+            minSegments.CalculateY(x + offset, yMin, count, globalYMin);
+            maxSegments.CalculateY(x + offset, yMax, count, globalYMax);
+            for (size_t i = 0; i < count; ++i) {
+                const float value = values[offset + i];
+                clamped[offset + i] = value < yMin[i] ? yMin[i] : (value > yMax[i] ? yMax[i] : value);
+            }
+        }
+    }
+
     /**
      * @brief Clears all segments from the piecewise maximum and minimum bounds.
      */
@@ -85,8 +186,8 @@ public:
 private:
     float globalYMin; ///< The global minimum y value for the piecewise bounds.
     float globalYMax; ///< The global maximum y value for the piecewise bounds.
-    PiecewiseBoundedLinearCurve<MaxMaxSegments> maxSegments; ///< Piecewise curve for maximum bounds.
-    PiecewiseBoundedLinearCurve<MaxMinSegments> minSegments; ///< Piecewise curve for minimum bounds.
+    PiecewiseBoundedLinearCurve<MaxMaxSegments, GridBuckets> maxSegments; ///< Piecewise curve for maximum bounds.
+    PiecewiseBoundedLinearCurve<MaxMinSegments, GridBuckets> minSegments; ///< Piecewise curve for minimum bounds.
 };
 
 #endif // HF_UTILS_GENERAL_PIECEWISEBOUNDS_H_
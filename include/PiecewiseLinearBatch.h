@@ -0,0 +1,163 @@
+/**
+ * @file PiecewiseLinearBatch.h
+ * @brief Array evaluation of sorted piecewise linear segment tables.
+ *
+ * A `SegmentTableView` is a structure-of-arrays view of segments sorted by
+ * xMin: starts (xMin), range bounds with the epsilon already applied, slopes
+ * and intercepts. `EvaluatePiecewiseBatch()` evaluates it over whole input
+ * arrays with the same rules as `PiecewiseBoundedLinearCurve`'s sorted
+ * search modes: the segment with the greatest xMin <= x, or its successor
+ * when x falls in the successor's epsilon band.
+ *
+ * Kernels, selected at compile time:
+ * - AVX2: 8 inputs at a time; the binary search runs in lockstep across
+ *   lanes (the probe sequence depends only on the segment count) with
+ *   `_mm256_i32gather_ps` loads and mask blends.
+ * - NEON: 4 inputs at a time; per-lane branchless search, vector range test,
+ *   select and multiply-add.
+ * - Scalar: everything else, and the tail of every array.
+ *
+ * ### Threading and allocation
+ * - No allocation; the table is only read.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_PIECEWISELINEARBATCH_H_
+#define HF_UTILS_GENERAL_PIECEWISELINEARBATCH_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "BitOps.h"
+#include "SegmentSearch.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace hf_utils {
+
+/**
+ * @brief Structure-of-arrays view of segments sorted by xMin.
+ */
+struct SegmentTableView {
+    const float* starts;       ///< xMin, ascending (search key)
+    const float* lows;         ///< xMin - epsilon
+    const float* highs;        ///< xMax + epsilon
+    const float* slopes;
+    const float* intercepts;
+    size_t count;
+};
+
+/**
+ * @brief Evaluate sorted slot `slot`, or its successor when `x` lies in the
+ *        successor's epsilon band.
+ *
+ * Earlier slots are not revisited, so an `x` covered only by a segment that
+ * encloses a later-starting one (nested overlap) is reported out of range.
+ * @return False (y untouched) if neither segment contains `x`.
+ */
+inline bool EvaluateSortedSegment(const SegmentTableView& table, size_t slot, float x, float& y) noexcept
+{
+    if (x >= table.lows[slot] && x <= table.highs[slot]) {
+        y = table.slopes[slot] * x + table.intercepts[slot];
+        return true;
+    }
+    const size_t next = slot + 1U;
+    if (next < table.count && x >= table.lows[next] && x <= table.highs[next]) {
+        y = table.slopes[next] * x + table.intercepts[next];
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Evaluate `table` at `n` inputs.
+ *
+ * @param table    Sorted segment table.
+ * @param x        Inputs.
+ * @param y        Outputs; may alias `x`.
+ * @param n        Number of inputs.
+ * @param fallback Output for inputs outside every segment (and NaN inputs).
+ * @return Number of inputs inside a segment.
+ */
+inline size_t EvaluatePiecewiseBatch(const SegmentTableView& table, const float* x, float* y, size_t n,
+                                     float fallback) noexcept
+{
+    size_t i = 0;
+    size_t inRange = 0;
+
+    if (table.count == 0U) {
+        for (; i < n; ++i) { y[i] = fallback; }
+        return 0;
+    }
+
+#if defined(__AVX2__)
+    const __m256 vFallback = _mm256_set1_ps(fallback);
+    const __m256i vOne = _mm256_set1_epi32(1);
+    const __m256i vLast = _mm256_set1_epi32(int32_t(table.count - 1U));
+    for (; i + 8U <= n; i += 8U) {
+        const __m256 vx = _mm256_loadu_ps(x + i);
+
+        __m256i slot = _mm256_setzero_si256();
+        for (size_t m = table.count; m > 1U; ) {
+            const size_t half = m / 2U;
+            const __m256i vHalf = _mm256_set1_epi32(int32_t(half));
+            const __m256 start = _mm256_i32gather_ps(table.starts, _mm256_add_epi32(slot, vHalf), 4);
+            const __m256i le = _mm256_castps_si256(_mm256_cmp_ps(start, vx, _CMP_LE_OQ));
+            slot = _mm256_add_epi32(slot, _mm256_and_si256(le, vHalf));
+            m -= half;
+        }
+
+        const __m256i next = _mm256_min_epi32(_mm256_add_epi32(slot, vOne), vLast);
+        const __m256 inSlot = _mm256_and_ps(_mm256_cmp_ps(vx, _mm256_i32gather_ps(table.lows, slot, 4), _CMP_GE_OQ),
+                                            _mm256_cmp_ps(vx, _mm256_i32gather_ps(table.highs, slot, 4), _CMP_LE_OQ));
+        const __m256 inNext = _mm256_and_ps(_mm256_cmp_ps(vx, _mm256_i32gather_ps(table.lows, next, 4), _CMP_GE_OQ),
+                                            _mm256_cmp_ps(vx, _mm256_i32gather_ps(table.highs, next, 4), _CMP_LE_OQ));
+        const __m256i chosen = _mm256_blendv_epi8(next, slot, _mm256_castps_si256(inSlot));
+        const __m256 value = _mm256_add_ps(_mm256_mul_ps(_mm256_i32gather_ps(table.slopes, chosen, 4), vx),
+                                           _mm256_i32gather_ps(table.intercepts, chosen, 4));
+        const __m256 ok = _mm256_or_ps(inSlot, inNext);
+        _mm256_storeu_ps(y + i, _mm256_blendv_ps(vFallback, value, ok));
+        inRange += PopCount(uint32_t(_mm256_movemask_ps(ok)));
+    }
+#elif defined(__ARM_NEON)
+    const float32x4_t vFallback = vdupq_n_f32(fallback);
+    for (; i + 4U <= n; i += 4U) {
+        const float32x4_t vx = vld1q_f32(x + i);
+        float lo[4], hi[4], nextLo[4], nextHi[4], slope[4], nextSlope[4], icpt[4], nextIcpt[4];
+        for (size_t lane = 0; lane < 4U; ++lane) {
+            const size_t slot = FindSegment(table.starts, table.count, x[i + lane]);
+            const size_t next = (slot + 1U < table.count) ? slot + 1U : slot;
+            lo[lane] = table.lows[slot];      hi[lane] = table.highs[slot];
+            nextLo[lane] = table.lows[next];  nextHi[lane] = table.highs[next];
+            slope[lane] = table.slopes[slot]; nextSlope[lane] = table.slopes[next];
+            icpt[lane] = table.intercepts[slot]; nextIcpt[lane] = table.intercepts[next];
+        }
+        const uint32x4_t inSlot = vandq_u32(vcgeq_f32(vx, vld1q_f32(lo)), vcleq_f32(vx, vld1q_f32(hi)));
+        const uint32x4_t inNext = vandq_u32(vcgeq_f32(vx, vld1q_f32(nextLo)), vcleq_f32(vx, vld1q_f32(nextHi)));
+        const float32x4_t s = vbslq_f32(inSlot, vld1q_f32(slope), vld1q_f32(nextSlope));
+        const float32x4_t b = vbslq_f32(inSlot, vld1q_f32(icpt), vld1q_f32(nextIcpt));
+        const uint32x4_t ok = vorrq_u32(inSlot, inNext);
+        vst1q_f32(y + i, vbslq_f32(ok, vmlaq_f32(b, s, vx), vFallback));
+        inRange += vgetq_lane_u32(ok, 0) & 1U;
+        inRange += vgetq_lane_u32(ok, 1) & 1U;
+        inRange += vgetq_lane_u32(ok, 2) & 1U;
+        inRange += vgetq_lane_u32(ok, 3) & 1U;
+    }
+#endif
+
+    for (; i < n; ++i) {
+        float value = fallback;
+        inRange += EvaluateSortedSegment(table, FindSegment(table.starts, table.count, x[i]), x[i], value) ? 1U : 0U;
+        y[i] = value;
+    }
+    return inRange;
+}
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_PIECEWISELINEARBATCH_H_ */
@@ -6,14 +6,38 @@
 #ifndef HF_UTILS_GENERAL_PIECEWISEBOUNDEDLINEARCURVE_H_
 #define HF_UTILS_GENERAL_PIECEWISEBOUNDEDLINEARCURVE_H_
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
 #include "BoundedLinearCurve.h"
 #include "DynamicArray.h"
+#include "PiecewiseLinearBatch.h"
+#include "SegmentSearch.h"
 
 /**
  * @brief Class to represent a piecewise linear curve using multiple BoundedLinearCurve segments.
+ *
+ * Segments are kept in insertion order and, alongside, in an index sorted by xMin. The search mode
+ * selects how CalculateY() locates a segment:
+ * - Linear (default): scan in insertion order, first segment in range wins (overlaps resolve by order).
+ * - Binary: branchless binary search over the sorted xMin values, O(log n).
+ * - Grid: uniform-grid bucket lookup then a short search, O(1) for evenly spread segments
+ *   (requires GridBuckets > 0, otherwise behaves as Binary).
+ * In the sorted modes, overlapping segments resolve to the one with the greatest xMin <= x, and only that
+ * segment (plus its successor's epsilon band) is checked: nested overlaps are not supported there. With
+ * [0, 10] and [2, 3], x = 5 finds [2, 3] and reports out of range, where Linear returns [0, 10]; use Linear
+ * for curves whose segments enclose one another.
+ * The CalculateY() overload taking a SegmentHint checks the last segment used first, for slowly varying inputs.
+ * The batch CalculateY(const float*, float*, size_t) evaluates whole arrays with the sorted-mode rules, using
+ * AVX2 gathers or NEON over a structure-of-arrays copy of the sorted segments.
+ *
  * @tparam MaxSegments The maximum number of segments allowed in the piecewise curve.
+ * @tparam GridBuckets Number of uniform-grid buckets for SegmentSearchMode::Grid (0 = no grid storage).
+ * @see CurveLookupTable.h for curves fixed at build time (constexpr table, no AddSegment() at startup).
  */
-template <uint8_t MaxSegments>
+template <uint8_t MaxSegments, size_t GridBuckets = 0>
 class PiecewiseBoundedLinearCurve {
 public:
     /**
@@ -27,7 +51,27 @@ public:
      * @return True if the segment was added successfully, false otherwise.
      */
     bool AddSegment(const BoundedLinearCurve& segment) {
-        return segments.Append(segment);
+        if (!segments.Append(segment)) {
+            return false;
+        }
+        InsertSorted(static_cast<uint8_t>(segments.size() - 1));
+        return true;
+    }
+
+    /**
+     * @brief Selects how CalculateY() locates the segment for an input.
+     * @param mode The search mode.
+     */
+    void SetSearchMode(hf_utils::SegmentSearchMode mode) noexcept {
+        searchMode = mode;
+    }
+
+    /**
+     * @brief Gets the current search mode.
+     * @return The search mode.
+     */
+    hf_utils::SegmentSearchMode GetSearchMode() const noexcept {
+        return searchMode;
     }
 
     /**
@@ -37,14 +81,65 @@ public:
      * @return True if the calculation was successful, false otherwise.
      */
     bool CalculateY(float x, float& y) const {
-        for (const auto& segment : segments) {
-            if (segment.InRange(x)) {
-                y = segment.CalculateY(x);
-                return true;
+        if (searchMode == hf_utils::SegmentSearchMode::Linear) {
+            for (const auto& segment : segments) {
+                if (segment.InRange(x)) {
+                    y = segment.CalculateY(x);
+                    return true;
+                }
             }
+            // Handle the case where x is out of range of all segments
+            return false;
+        }
+        if (segments.empty()) {
+            return false;
         }
-        // Handle the case where x is out of range of all segments
-        return false;
+        const size_t slot = (searchMode == hf_utils::SegmentSearchMode::Grid)
+            ? grid.Find(segmentStarts.data(), segments.size(), x)
+            : hf_utils::FindSegment(segmentStarts.data(), segments.size(), x);
+        return hf_utils::EvaluateSortedSegment(Table(), slot, x, y);
+    }
+
+    /**
+     * @brief Calculates the y value for a given x, starting from the segment found by the previous call.
+     *
+     * Uses the sorted index whatever the search mode; O(1) while x stays in the same or the next segment.
+     * @param x The x value.
+     * @param y The reference to store the calculated y value.
+     * @param hint Caller-owned cache of the last segment (one per input stream).
+     * @return True if the calculation was successful, false otherwise.
+     */
+    bool CalculateY(float x, float& y, hf_utils::SegmentHint& hint) const {
+        if (segments.empty()) {
+            return false;
+        }
+        return hf_utils::EvaluateSortedSegment(Table(), hf_utils::FindSegment(segmentStarts.data(), segments.size(), x, hint), x, y);
+    }
+
+    /**
+     * @brief Calculates y for every input of an array, with the sorted-mode rules whatever the search mode.
+     * @param x Input values.
+     * @param y Output values (may alias x); NaN where x is out of range of all segments.
+     * @param n Number of values.
+     * @return Number of inputs that were in range.
+     */
+    size_t CalculateY(const float* x, float* y, size_t n) const noexcept {
+        return CalculateY(x, y, n, std::numeric_limits<float>::quiet_NaN());
+    }
+
+    /**
+     * @brief Batch CalculateY() writing `fallback` for inputs out of range of all segments.
+     */
+    size_t CalculateY(const float* x, float* y, size_t n, float fallback) const noexcept {
+        return hf_utils::EvaluatePiecewiseBatch(Table(), x, y, n, fallback);
+    }
+
+    /**
+     * @brief Returns a view of the sorted structure-of-arrays segment table used by the batch API.
+     */
+    hf_utils::SegmentTableView Table() const noexcept {
+        return { segmentStarts.data(), sortedLow.data(), sortedHigh.data(),
+                 sortedSlope.data(), sortedIntercept.data(), segments.size() };
     }
 
     /**
@@ -54,8 +149,50 @@ public:
         segments.ClearAll();
     }
 
+    /**
+     * @brief Returns the number of segments in the curve.
+     */
+    size_t SegmentCount() const noexcept {
+        return segments.size();
+    }
+
 private:
-    DynamicArray<BoundedLinearCurve, MaxSegments> segments; ///< Array to store the segments.
+    /**
+     * @brief Adds segment `index` to the sorted table (stable for equal xMin) and rebuilds the grid.
+     */
+    void InsertSorted(uint8_t index) noexcept {
+        const BoundedLinearCurve& added = segments[index];
+        const float start = added.GetXMin();
+        size_t slot = index;
+        while (slot > 0 && segmentStarts[slot - 1] > start) {
+            segmentStarts[slot] = segmentStarts[slot - 1];
+            sortedLow[slot] = sortedLow[slot - 1];
+            sortedHigh[slot] = sortedHigh[slot - 1];
+            sortedSlope[slot] = sortedSlope[slot - 1];
+            sortedIntercept[slot] = sortedIntercept[slot - 1];
+            --slot;
+        }
+        segmentStarts[slot] = start;
+        sortedLow[slot] = added.GetXMin() - added.GetEpsilon();          // same bounds as BoundedLinearCurve::InRange()
+        sortedHigh[slot] = added.GetXMax() + added.GetEpsilon();
+        sortedSlope[slot] = added.GetSlope();
+        sortedIntercept[slot] = added.GetIntercept();
+
+        float end = segments[0].GetXMax();
+        for (const auto& segment : segments) {
+            end = segment.GetXMax() > end ? segment.GetXMax() : end;
+        }
+        grid.Build(segmentStarts.data(), segments.size(), end);
+    }
+
+    DynamicArray<BoundedLinearCurve, MaxSegments> segments;          ///< Array to store the segments.
+    std::array<float, MaxSegments> segmentStarts{};                  ///< Segment xMin values, ascending.
+    std::array<float, MaxSegments> sortedLow{};                      ///< xMin - epsilon, per sorted slot.
+    std::array<float, MaxSegments> sortedHigh{};                     ///< xMax + epsilon, per sorted slot.
+    std::array<float, MaxSegments> sortedSlope{};                    ///< Slope, per sorted slot.
+    std::array<float, MaxSegments> sortedIntercept{};                ///< Intercept, per sorted slot.
+    hf_utils::UniformSegmentGrid<GridBuckets> grid;                  ///< Bucket table for SegmentSearchMode::Grid.
+    hf_utils::SegmentSearchMode searchMode = hf_utils::SegmentSearchMode::Linear; ///< How CalculateY() searches.
 };
 
 #endif // HF_UTILS_GENERAL_PIECEWISEBOUNDEDLINEARCURVE_H_
@@ -0,0 +1,98 @@
+/**
+ * @file PreciseDelay.h
+ * @brief Low-jitter delays: sleep until shortly before the deadline, then spin.
+ *
+ * OS sleeps overshoot by the scheduler tick / timer slack (tens of µs on a
+ * Linux host, a full tick on an RTOS), while a pure spin burns a core for
+ * the whole wait. `PreciseSleepUntil()` combines the two: it sleeps until
+ * `spinWindow` before the deadline and spins (with a CPU relax hint) for
+ * only that last stretch, on `std::chrono::steady_clock`.
+ *
+ * \code{.cpp}
+ * auto next = std::chrono::steady_clock::now();
+ * for (;;) {
+ *     next += std::chrono::microseconds(250);   // 4 kHz loop, no drift
+ *     hf_utils::PreciseSleepUntil(next);
+ *     SampleAdc();
+ * }
+ * \endcode
+ *
+ * ### Configuration
+ * - `HF_UTILS_PRECISE_DELAY_SPIN_US` (default 100): default spin window.
+ *   Raise it if the OS sleep overshoots more than that; `0` disables
+ *   spinning (plain sleep).
+ *
+ * ### Threading and allocation
+ * - No allocation; safe from any thread. Only the calling thread blocks.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_PRECISEDELAY_H_
+#define HF_UTILS_GENERAL_PRECISEDELAY_H_
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#ifndef HF_UTILS_PRECISE_DELAY_SPIN_US
+#define HF_UTILS_PRECISE_DELAY_SPIN_US 100
+#endif
+
+namespace hf_utils {
+
+/// Default length of the final busy-wait before a deadline.
+constexpr std::chrono::microseconds kPreciseDelaySpinWindow{HF_UTILS_PRECISE_DELAY_SPIN_US};
+
+/**
+ * @brief Hint to the CPU that the caller is in a spin-wait loop.
+ */
+inline void CpuRelax() noexcept
+{
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_ia32_pause();
+#elif (defined(__aarch64__) || defined(__arm__)) && (defined(__GNUC__) || defined(__clang__))
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/**
+ * @brief Block until the absolute `deadline`.
+ *
+ * @param deadline   Absolute `steady_clock` time; past deadlines return at once.
+ * @param spinWindow Time before the deadline spent spinning instead of sleeping.
+ */
+inline void PreciseSleepUntil(std::chrono::steady_clock::time_point deadline,
+                              std::chrono::nanoseconds spinWindow = kPreciseDelaySpinWindow) noexcept
+{
+    using std::chrono::steady_clock;
+    const steady_clock::time_point wakeAt = deadline - spinWindow;
+    if (steady_clock::now() < wakeAt) {
+        std::this_thread::sleep_until(wakeAt);
+    }
+    while (steady_clock::now() < deadline) {
+        CpuRelax();
+    }
+}
+
+/**
+ * @brief Block for a relative duration of any `std::chrono` unit.
+ */
+template <typename Rep, typename Period>
+inline void PreciseDelay(std::chrono::duration<Rep, Period> duration,
+                         std::chrono::nanoseconds spinWindow = kPreciseDelaySpinWindow) noexcept
+{
+    PreciseSleepUntil(std::chrono::steady_clock::now() +
+                          std::chrono::duration_cast<std::chrono::steady_clock::duration>(duration),
+                      spinWindow);
+}
+
+/// Block for `us` microseconds.
+inline void PreciseDelayUs(uint32_t us) noexcept { PreciseDelay(std::chrono::microseconds(us)); }
+
+/// Block for `ns` nanoseconds.
+inline void PreciseDelayNs(uint64_t ns) noexcept { PreciseDelay(std::chrono::nanoseconds(ns)); }
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_PRECISEDELAY_H_ */
@@ -0,0 +1,265 @@
+/**
+ * @file Quantity.h
+ * @brief Compile-time dimensional units: a value whose unit lives in its type.
+ *
+ * `VariableWithUnit<T, U>` stores the unit next to the value and checks it at
+ * run time. `Quantity<Unit, T>` stores only the value (`sizeof(T)`); the unit
+ * is a type made of
+ * - a `Dimension<Length, Mass, Time, Temperature>` of integer exponents,
+ * - a `std::ratio` scale to the SI base unit of that dimension,
+ * - a `std::ratio` offset (non-zero only for Celsius / Fahrenheit).
+ *
+ * Conversions between units of one dimension fold to a single constexpr
+ * multiply (plus an add for offset units); adding a pressure to a flow, or
+ * assigning a time to a temperature, does not compile.
+ *
+ * \code{.cpp}
+ * using namespace hf_utils::units;
+ * constexpr hf_utils::Quantity<Psi> limit{14.5F};
+ * hf_utils::Quantity<Millibar> reading{980.0F};
+ * if (reading > limit) { ... }                                  // compared in millibar
+ * auto kpa = hf_utils::QuantityCast<Pascal>(reading).Value() / 1000.0F;
+ * auto rate = hf_utils::Quantity<Pascal>{5.0F} / hf_utils::Quantity<Seconds>{2.0F}; // Pa/s
+ * VariableWithUnit<float, pressure_unit_id_t> legacy = hf_utils::ToVariableWithUnit(reading);
+ * \endcode
+ *
+ * Unit definitions use the SI / international conventional values.
+ *
+ * ### Threading and allocation
+ * - Plain value type; no allocation, no shared state.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_QUANTITY_H_
+#define HF_UTILS_GENERAL_QUANTITY_H_
+
+#include <cassert>
+#include <ratio>
+#include <type_traits>
+
+#include "Utility.h"
+#include "VariableWithUnit.h"
+
+namespace hf_utils {
+
+/**
+ * @brief Integer exponents of the base dimensions.
+ */
+template <int Length, int Mass, int Time, int Temperature>
+struct Dimension {
+    static constexpr int length = Length;
+    static constexpr int mass = Mass;
+    static constexpr int time = Time;
+    static constexpr int temperature = Temperature;
+};
+
+/// Product of two dimensions (exponents add).
+template <typename A, typename B>
+using DimensionMultiply = Dimension<A::length + B::length, A::mass + B::mass,
+                                    A::time + B::time, A::temperature + B::temperature>;
+
+/// Quotient of two dimensions (exponents subtract).
+template <typename A, typename B>
+using DimensionDivide = Dimension<A::length - B::length, A::mass - B::mass,
+                                  A::time - B::time, A::temperature - B::temperature>;
+
+/**
+ * @brief A unit: `base = value * Scale + Offset` in SI units of `Dim`.
+ */
+template <typename Dim, typename Scale, typename Offset = std::ratio<0>>
+struct Unit {
+    using dimension = Dim;
+    using scale = Scale;
+    using offset = Offset;
+};
+
+/**
+ * @brief Value of type `T` in unit `U`; same size as `T`.
+ */
+template <typename U, typename T = float>
+class Quantity {
+public:
+    using unit = U;
+    using value_type = T;
+
+    constexpr Quantity() noexcept : value_() {}
+    constexpr explicit Quantity(T value) noexcept : value_(value) {}
+
+    /// Implicit conversion from another unit of the same dimension.
+    template <typename U2>
+    constexpr Quantity(const Quantity<U2, T>& other) noexcept;
+
+    /// @return Numeric value in unit `U`.
+    constexpr T Value() const noexcept { return value_; }
+
+    constexpr Quantity operator+(const Quantity& other) const noexcept { return Quantity(value_ + other.value_); }
+    constexpr Quantity operator-(const Quantity& other) const noexcept { return Quantity(value_ - other.value_); }
+    constexpr Quantity operator-() const noexcept { return Quantity(-value_); }
+    constexpr Quantity operator*(T scalar) const noexcept { return Quantity(value_ * scalar); }
+    constexpr Quantity operator/(T scalar) const noexcept { return Quantity(value_ / scalar); }
+
+    Quantity& operator+=(const Quantity& other) noexcept { value_ += other.value_; return *this; }
+    Quantity& operator-=(const Quantity& other) noexcept { value_ -= other.value_; return *this; }
+    Quantity& operator*=(T scalar) noexcept { value_ *= scalar; return *this; }
+    Quantity& operator/=(T scalar) noexcept { value_ /= scalar; return *this; }
+
+    constexpr bool operator==(const Quantity& other) const noexcept { return value_ == other.value_; }
+    constexpr bool operator!=(const Quantity& other) const noexcept { return value_ != other.value_; }
+    constexpr bool operator<(const Quantity& other) const noexcept { return value_ < other.value_; }
+    constexpr bool operator<=(const Quantity& other) const noexcept { return value_ <= other.value_; }
+    constexpr bool operator>(const Quantity& other) const noexcept { return value_ > other.value_; }
+    constexpr bool operator>=(const Quantity& other) const noexcept { return value_ >= other.value_; }
+
+private:
+    T value_;
+};
+
+/**
+ * @brief Convert to unit `To` (same dimension), folded into one multiply-add.
+ */
+template <typename To, typename From, typename T>
+constexpr Quantity<To, T> QuantityCast(const Quantity<From, T>& q) noexcept
+{
+    static_assert(std::is_same<typename From::dimension, typename To::dimension>::value,
+                  "QuantityCast between different dimensions.");
+    using Factor = std::ratio_divide<typename From::scale, typename To::scale>;
+    using Shift  = std::ratio_divide<std::ratio_subtract<typename From::offset, typename To::offset>,
+                                     typename To::scale>;
+    constexpr T factor = static_cast<T>(Factor::num) / static_cast<T>(Factor::den);
+    constexpr T shift  = static_cast<T>(Shift::num) / static_cast<T>(Shift::den);
+    return Quantity<To, T>(q.Value() * factor + shift);
+}
+
+template <typename U, typename T>
+template <typename U2>
+constexpr Quantity<U, T>::Quantity(const Quantity<U2, T>& other) noexcept
+    : value_(QuantityCast<U>(other).Value())
+{ }
+
+/// Scalar on the left.
+template <typename U, typename T>
+constexpr Quantity<U, T> operator*(T scalar, const Quantity<U, T>& q) noexcept
+{
+    return q * scalar;
+}
+
+/// Product of two quantities; the result unit combines dimensions and scales.
+template <typename U1, typename U2, typename T>
+constexpr auto operator*(const Quantity<U1, T>& a, const Quantity<U2, T>& b) noexcept
+{
+    static_assert(std::ratio_equal<typename U1::offset, std::ratio<0>>::value &&
+                  std::ratio_equal<typename U2::offset, std::ratio<0>>::value,
+                  "Offset units (Celsius, Fahrenheit) cannot be multiplied; convert to Kelvin first.");
+    using Result = Unit<DimensionMultiply<typename U1::dimension, typename U2::dimension>,
+                        std::ratio_multiply<typename U1::scale, typename U2::scale>>;
+    return Quantity<Result, T>(a.Value() * b.Value());
+}
+
+/// Quotient of two quantities; the result unit combines dimensions and scales.
+template <typename U1, typename U2, typename T>
+constexpr auto operator/(const Quantity<U1, T>& a, const Quantity<U2, T>& b) noexcept
+{
+    static_assert(std::ratio_equal<typename U1::offset, std::ratio<0>>::value &&
+                  std::ratio_equal<typename U2::offset, std::ratio<0>>::value,
+                  "Offset units (Celsius, Fahrenheit) cannot be divided; convert to Kelvin first.");
+    using Result = Unit<DimensionDivide<typename U1::dimension, typename U2::dimension>,
+                        std::ratio_divide<typename U1::scale, typename U2::scale>>;
+    return Quantity<Result, T>(a.Value() / b.Value());
+}
+
+//==============================================================//
+/// UNITS
+//==============================================================//
+
+namespace units {
+
+using Dimensionless  = Dimension<0, 0, 0, 0>;
+using LengthDim      = Dimension<1, 0, 0, 0>;
+using TimeDim        = Dimension<0, 0, 1, 0>;
+using TemperatureDim = Dimension<0, 0, 0, 1>;
+using PressureDim    = Dimension<-1, 1, -2, 0>;
+using FlowDim        = Dimension<3, 0, -1, 0>;
+
+using Nanoseconds  = Unit<TimeDim, std::nano>;
+using Microseconds = Unit<TimeDim, std::micro>;
+using Milliseconds = Unit<TimeDim, std::milli>;
+using Seconds      = Unit<TimeDim, std::ratio<1>>;
+using Minutes      = Unit<TimeDim, std::ratio<60>>;
+using Hours        = Unit<TimeDim, std::ratio<3600>>;
+using Days         = Unit<TimeDim, std::ratio<86400>>;
+
+using Kelvin     = Unit<TemperatureDim, std::ratio<1>>;
+using Celsius    = Unit<TemperatureDim, std::ratio<1>, std::ratio<27315, 100>>;
+using Fahrenheit = Unit<TemperatureDim, std::ratio<5, 9>, std::ratio<45967 * 5, 900>>;
+
+using Pascal   = Unit<PressureDim, std::ratio<1>>;
+using Millibar = Unit<PressureDim, std::ratio<100>>;
+using Bar      = Unit<PressureDim, std::ratio<100000>>;
+using Atm      = Unit<PressureDim, std::ratio<101325>>;
+using Psi      = Unit<PressureDim, std::ratio<6894757293168LL, 1000000000LL>>;
+using MmHg     = Unit<PressureDim, std::ratio<133322387415LL, 1000000000LL>>;
+using InHg     = Unit<PressureDim, std::ratio<3386388640341LL, 1000000000LL>>;
+
+using CubicMetersPerSecond = Unit<FlowDim, std::ratio<1>>;
+using Slpm                 = Unit<FlowDim, std::ratio<1, 60000>>;           ///< litre per minute
+using Cmh                  = Unit<FlowDim, std::ratio<1, 3600>>;            ///< cubic metre per hour
+using Cfm                  = Unit<FlowDim, std::ratio<28316846592LL, 60000000000000LL>>; ///< cubic foot per minute
+
+} // namespace units
+
+//==============================================================//
+/// VariableWithUnit INTEROP
+//==============================================================//
+
+/**
+ * @brief Runtime unit ID of a compile-time unit, for `ToVariableWithUnit()`.
+ *
+ * Specialised for every unit that has a `*_unit_id_t` / `TimeUnit` counterpart.
+ */
+template <typename U>
+struct RuntimeUnitOf;
+
+#define HF_UTILS_QUANTITY_RUNTIME_UNIT(UnitType, Id) \
+    template <> struct RuntimeUnitOf<units::UnitType> { static constexpr auto value = Id; }
+
+HF_UTILS_QUANTITY_RUNTIME_UNIT(Nanoseconds, NANOSECONDS);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(Microseconds, MICROSECONDS);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(Milliseconds, MILLISECONDS);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(Seconds, SECONDS);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(Minutes, MINUTES);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(Hours, HOURS);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(Days, DAYS);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(Kelvin, TEMP_K);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(Celsius, TEMP_C);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(Fahrenheit, TEMP_F);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(Pascal, PRESSURE_UNIT_PA);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(Millibar, PRESSURE_UNIT_MBAR);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(Bar, PRESSURE_UNIT_BAR);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(Atm, PRESSURE_UNIT_ATM);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(Psi, PRESSURE_UNIT_PSI);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(MmHg, PRESSURE_UNIT_MMHG);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(InHg, PRESSURE_UNIT_INHG);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(Slpm, FLOW_UNIT_SLPM);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(Cmh, FLOW_UNIT_CMH);
+HF_UTILS_QUANTITY_RUNTIME_UNIT(Cfm, FLOW_UNIT_CFM);
+
+#undef HF_UTILS_QUANTITY_RUNTIME_UNIT
+
+/**
+ * @brief Hand a compile-time quantity to code that still takes `VariableWithUnit`.
+ *
+ * The value is passed through unchanged. The runtime `ConvertPressureUnit()` /
+ * `ConvertFlowUnit()` constants carry about six significant digits, so their
+ * results match `QuantityCast()` to that precision.
+ */
+template <typename U, typename T>
+VariableWithUnit<T, typename std::remove_const<decltype(RuntimeUnitOf<U>::value)>::type>
+ToVariableWithUnit(const Quantity<U, T>& q) noexcept
+{
+    return {q.Value(), RuntimeUnitOf<U>::value};
+}
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_QUANTITY_H_ */
@@ -0,0 +1,351 @@
+/**
+ * @file RateLimiter.h
+ * @brief Lock-free token-bucket and sliding-window rate limiters, plus a
+ *        `RateLimitedAction` wrapper with a templated callable.
+ *
+ * `ActionRunLimiter` caps the *total* number of runs until a manual
+ * `Reset()`. The limiters here cap the *rate* instead — e.g. at most 20 log
+ * lines per second, or 5 retransmits per 100 ms window — and refill on
+ * their own as time passes.
+ *
+ * - `TokenBucketLimiter`: bursts of up to `capacity`, refilled continuously
+ *   at `refillPerSecond` tokens per second.
+ * - `SlidingWindowLimiter`: at most `limit` events in any `windowMs` span,
+ *   using the two-window weighted estimate (previous window count scaled by
+ *   its remaining overlap plus the current window count).
+ *
+ * Each limiter packs its whole state in one `std::atomic<uint64_t>` and
+ * updates it with a compare-and-swap loop, so acquisitions from several
+ * threads never block each other.
+ *
+ * ### Threading and allocation
+ * - No allocation. Lock-free on targets with 64-bit atomics.
+ * - `RateLimitedAction::RunIfAllowed()` may be called from several threads;
+ *   its suppressed-run counter is atomic. The action itself must tolerate
+ *   concurrent calls in that case.
+ * - Time is a `uint32_t` millisecond stamp (wrap-safe); every call has an
+ *   overload taking an explicit `now_ms` and one that reads
+ *   `GetElapsedTimeMsec()`.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_RATELIMITER_H_
+#define HF_UTILS_GENERAL_RATELIMITER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "Utility.h"
+
+namespace hf_utils {
+
+/**
+ * @brief Token bucket: `capacity` burst, `refillPerSecond` sustained rate.
+ *
+ * Tokens are tracked in thousandths so a refill rate in tokens per second
+ * accrues exactly per millisecond.
+ */
+class TokenBucketLimiter {
+public:
+    /// Largest supported capacity (milli-tokens must fit in 32 bits).
+    static constexpr uint32_t kMaxCapacity = 0xFFFFFFFFU / 1000U;
+
+    /**
+     * @brief Construct a full bucket.
+     *
+     * @param capacity        Maximum burst in tokens (clamped to `kMaxCapacity`).
+     * @param refillPerSecond Tokens added per second.
+     * @param now_ms          Current time.
+     */
+    TokenBucketLimiter(uint32_t capacity, uint32_t refillPerSecond, uint32_t now_ms) noexcept
+        : capacityMilli_(std::min(capacity, kMaxCapacity) * 1000U)
+        , refillPerSecond_(refillPerSecond)
+        , state_(Pack(now_ms, capacityMilli_))
+    { }
+
+    /// @copydoc TokenBucketLimiter(uint32_t, uint32_t, uint32_t)
+    TokenBucketLimiter(uint32_t capacity, uint32_t refillPerSecond) noexcept
+        : TokenBucketLimiter(capacity, refillPerSecond, GetElapsedTimeMsec())
+    { }
+
+    TokenBucketLimiter(const TokenBucketLimiter&)            = delete;
+    TokenBucketLimiter& operator=(const TokenBucketLimiter&) = delete;
+
+    /**
+     * @brief Take `tokens` if available.
+     *
+     * @param tokens Tokens to consume.
+     * @param now_ms Current time.
+     * @return True if the tokens were taken.
+     */
+    bool TryAcquire(uint32_t tokens, uint32_t now_ms) noexcept
+    {
+        const uint64_t needMilli = static_cast<uint64_t>(tokens) * 1000U;
+        uint64_t old = state_.load(std::memory_order_relaxed);
+        for (;;) {
+            uint32_t last = 0;
+            const uint32_t milli = Refill(old, now_ms, last);
+            if (milli < needMilli) { return false; }
+            const uint64_t desired = Pack(last, static_cast<uint32_t>(milli - needMilli));
+            if (state_.compare_exchange_weak(old, desired,
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+    }
+
+    /// @copydoc TryAcquire(uint32_t, uint32_t)
+    bool TryAcquire(uint32_t tokens = 1U) noexcept { return TryAcquire(tokens, GetElapsedTimeMsec()); }
+
+    /**
+     * @brief Whole tokens currently available.
+     */
+    uint32_t AvailableTokens(uint32_t now_ms) const noexcept
+    {
+        uint32_t last = 0;
+        return Refill(state_.load(std::memory_order_relaxed), now_ms, last) / 1000U;
+    }
+
+    /// @copydoc AvailableTokens(uint32_t) const
+    uint32_t AvailableTokens() const noexcept { return AvailableTokens(GetElapsedTimeMsec()); }
+
+    /**
+     * @brief Refill the bucket to capacity.
+     */
+    void Reset(uint32_t now_ms) noexcept
+    {
+        state_.store(Pack(now_ms, capacityMilli_), std::memory_order_release);
+    }
+
+private:
+    static constexpr uint64_t Pack(uint32_t stamp, uint32_t milli) noexcept
+    {
+        return (static_cast<uint64_t>(stamp) << 32) | milli;
+    }
+
+    /**
+     * @brief Milli-tokens available at `now_ms` for packed state `s`.
+     * @param[out] last Refill stamp to store back with the result.
+     */
+    uint32_t Refill(uint64_t s, uint32_t now_ms, uint32_t& last) const noexcept
+    {
+        last = static_cast<uint32_t>(s >> 32);
+        const uint32_t milli = static_cast<uint32_t>(s);
+        const int32_t elapsed = static_cast<int32_t>(now_ms - last);
+        if (elapsed <= 0) { return milli; } // another caller already refilled with a later stamp
+        last = now_ms;
+        const uint64_t refilled = milli + static_cast<uint64_t>(elapsed) * refillPerSecond_;
+        return static_cast<uint32_t>(std::min<uint64_t>(refilled, capacityMilli_));
+    }
+
+    const uint32_t        capacityMilli_;
+    const uint32_t        refillPerSecond_;
+    std::atomic<uint64_t> state_;
+};
+
+/**
+ * @brief At most `limit` events in any `windowMs` span (weighted two-window estimate).
+ */
+class SlidingWindowLimiter {
+public:
+    /// Largest supported per-window limit (counts are packed in 16 bits).
+    static constexpr uint32_t kMaxLimit = 0xFFFFU;
+
+    /**
+     * @brief Construct an empty window.
+     *
+     * @param limit    Events allowed per window (clamped to `kMaxLimit`).
+     * @param windowMs Window length in ms (minimum 1).
+     * @param now_ms   Current time; starts the first window.
+     */
+    SlidingWindowLimiter(uint32_t limit, uint32_t windowMs, uint32_t now_ms) noexcept
+        : limit_(std::min(limit, kMaxLimit))
+        , windowMs_(std::max<uint32_t>(windowMs, 1U))
+        , state_(Pack(now_ms, 0U, 0U))
+    { }
+
+    /// @copydoc SlidingWindowLimiter(uint32_t, uint32_t, uint32_t)
+    SlidingWindowLimiter(uint32_t limit, uint32_t windowMs) noexcept
+        : SlidingWindowLimiter(limit, windowMs, GetElapsedTimeMsec())
+    { }
+
+    SlidingWindowLimiter(const SlidingWindowLimiter&)            = delete;
+    SlidingWindowLimiter& operator=(const SlidingWindowLimiter&) = delete;
+
+    /**
+     * @brief Record one event if the rate allows it.
+     *
+     * @param now_ms Current time.
+     * @return True if the event is allowed (and counted).
+     */
+    bool TryAcquire(uint32_t now_ms) noexcept
+    {
+        uint64_t old = state_.load(std::memory_order_relaxed);
+        for (;;) {
+            Window w = Advance(old, now_ms);
+            if (Estimate(w) >= limit_) { return false; }
+            const uint64_t desired = Pack(w.start, w.current + 1U, w.previous);
+            if (state_.compare_exchange_weak(old, desired,
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+    }
+
+    /// @copydoc TryAcquire(uint32_t)
+    bool TryAcquire() noexcept { return TryAcquire(GetElapsedTimeMsec()); }
+
+    /**
+     * @brief Weighted event count over the trailing window.
+     */
+    uint32_t CurrentCount(uint32_t now_ms) const noexcept
+    {
+        return Estimate(Advance(state_.load(std::memory_order_relaxed), now_ms));
+    }
+
+    /// @copydoc CurrentCount(uint32_t) const
+    uint32_t CurrentCount() const noexcept { return CurrentCount(GetElapsedTimeMsec()); }
+
+    /**
+     * @brief Forget all history and start a new window at `now_ms`.
+     */
+    void Reset(uint32_t now_ms) noexcept
+    {
+        state_.store(Pack(now_ms, 0U, 0U), std::memory_order_release);
+    }
+
+private:
+    struct Window {
+        uint32_t start;
+        uint32_t current;
+        uint32_t previous;
+        uint32_t intoWindow; ///< ms elapsed in the current window
+    };
+
+    static constexpr uint64_t Pack(uint32_t start, uint32_t current, uint32_t previous) noexcept
+    {
+        return (static_cast<uint64_t>(start) << 32) |
+               (static_cast<uint64_t>(current & 0xFFFFU) << 16) |
+               (previous & 0xFFFFU);
+    }
+
+    Window Advance(uint64_t s, uint32_t now_ms) const noexcept
+    {
+        Window w{static_cast<uint32_t>(s >> 32),
+                 static_cast<uint32_t>((s >> 16) & 0xFFFFU),
+                 static_cast<uint32_t>(s & 0xFFFFU),
+                 0U};
+        const int32_t since = static_cast<int32_t>(now_ms - w.start);
+        if (since <= 0) { return w; }
+
+        uint32_t into = static_cast<uint32_t>(since);
+        if (into >= windowMs_) {
+            const uint32_t windows = into / windowMs_;
+            w.previous = (windows == 1U) ? w.current : 0U;
+            w.current  = 0U;
+            w.start   += windows * windowMs_;
+            into      -= windows * windowMs_;
+        }
+        w.intoWindow = into;
+        return w;
+    }
+
+    uint32_t Estimate(const Window& w) const noexcept
+    {
+        const uint64_t weightedPrev =
+            static_cast<uint64_t>(w.previous) * (windowMs_ - w.intoWindow) / windowMs_;
+        return static_cast<uint32_t>(weightedPrev) + w.current;
+    }
+
+    const uint32_t        limit_;
+    const uint32_t        windowMs_;
+    std::atomic<uint64_t> state_;
+};
+
+/**
+ * @brief Runs a callable only when a rate limiter grants a permit.
+ *
+ * Rate-based counterpart of `ActionRunLimiter`. The action is stored by
+ * value as its own type (no `std::function`), so lambdas with captures
+ * stay inline and calls are direct.
+ *
+ * \code{.cpp}
+ * TokenBucketLimiter bucket(20U, 10U);           // 20-line burst, 10 lines/s
+ * auto logOnce = MakeRateLimitedAction(bucket, [&] { LogOverTemp(temp); });
+ * logOnce.RunIfAllowed();
+ * \endcode
+ *
+ * @tparam Limiter `TokenBucketLimiter` or `SlidingWindowLimiter` (anything
+ *                 with `bool TryAcquire()`).
+ * @tparam Action  Callable; may return `bool` (success) or `void`.
+ */
+template <typename Limiter, typename Action>
+class RateLimitedAction {
+public:
+    /**
+     * @param limiter Shared limiter; must outlive this object.
+     * @param action  Callable to guard.
+     */
+    RateLimitedAction(Limiter& limiter, Action action) noexcept(std::is_nothrow_move_constructible<Action>::value)
+        : limiter_(limiter)
+        , action_(std::move(action))
+    { }
+
+    RateLimitedAction(const RateLimitedAction& other)
+        : limiter_(other.limiter_)
+        , action_(other.action_)
+        , suppressed_(other.SuppressedCount())
+    { }
+
+    RateLimitedAction(RateLimitedAction&& other) noexcept(std::is_nothrow_move_constructible<Action>::value)
+        : limiter_(other.limiter_)
+        , action_(std::move(other.action_))
+        , suppressed_(other.SuppressedCount())
+    { }
+
+    /**
+     * @brief Run the action if a permit is available.
+     *
+     * @return True if the action ran (and, for `bool` actions, returned true).
+     */
+    bool RunIfAllowed()
+    {
+        if (!limiter_.TryAcquire()) {
+            suppressed_.fetch_add(1U, std::memory_order_relaxed);
+            return false;
+        }
+        if constexpr (std::is_same<decltype(action_()), bool>::value) {
+            return action_();
+        } else {
+            action_();
+            return true;
+        }
+    }
+
+    /// @return Number of runs refused by the limiter since construction.
+    uint32_t SuppressedCount() const noexcept { return suppressed_.load(std::memory_order_relaxed); }
+
+private:
+    Limiter& limiter_;
+    Action   action_;
+    std::atomic<uint32_t> suppressed_{0};   ///< Counted from every thread sharing this action
+};
+
+/**
+ * @brief Deduce the action type for `RateLimitedAction`.
+ */
+template <typename Limiter, typename Action>
+RateLimitedAction<Limiter, Action> MakeRateLimitedAction(Limiter& limiter, Action action)
+{
+    return RateLimitedAction<Limiter, Action>(limiter, std::move(action));
+}
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_RATELIMITER_H_ */
@@ -0,0 +1,189 @@
+/**
+ * @file SegmentSearch.h
+ * @brief Segment lookup over sorted breakpoints: branchless binary search,
+ *        last-segment hint and a uniform-grid accelerator.
+ *
+ * All searches answer the same question: given ascending segment start
+ * positions `starts[0..count)`, which segment `i` has
+ * `starts[i] <= x < starts[i + 1]`? Inputs below `starts[0]` map to segment
+ * 0 and inputs past the last start map to segment `count - 1`; callers check
+ * the segment's own range afterwards.
+ *
+ * - `FindSegment(starts, count, x)`: branchless binary search, fixed
+ *   `ceil(log2(count))` iterations of a conditional move.
+ * - `FindSegment(starts, count, x, hint)`: checks the hinted segment and its
+ *   successor first, which is O(1) for slowly varying inputs.
+ * - `UniformSegmentGrid<Buckets>`: maps `x` to a bucket with one multiply
+ *   and resolves the segment in one branchless step when the bucket holds at
+ *   most one breakpoint (size `Buckets` at about twice the segment count).
+ *
+ * Used by `PiecewiseBoundedLinearCurve` and the spline curves.
+ *
+ * ### Threading and allocation
+ * - No allocation. Searches are const and re-entrant; a `SegmentHint` is
+ *   owned by its caller, so each thread or channel keeps its own.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_SEGMENTSEARCH_H_
+#define HF_UTILS_GENERAL_SEGMENTSEARCH_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace hf_utils {
+
+/**
+ * @brief How a piecewise curve locates the segment for an input.
+ */
+enum class SegmentSearchMode : uint8_t {
+    Linear,   ///< Scan every segment in insertion order (original behaviour, first match wins)
+    Binary,   ///< Branchless binary search over the sorted segment starts
+    Grid      ///< Uniform-grid bucket, then at most a short search within the bucket
+};
+
+/**
+ * @brief Caller-owned cache of the last segment found.
+ */
+struct SegmentHint {
+    size_t index = 0;
+};
+
+//==============================================================//
+/// SEARCH
+//==============================================================//
+
+/**
+ * @brief Branchless search for the last start `<= x`.
+ *
+ * @param starts Ascending segment starts.
+ * @param count  Number of starts; must be at least 1.
+ * @param x      Input.
+ * @return Index in `[0, count)`; 0 if `x < starts[0]` (or `x` is NaN).
+ */
+template <typename T>
+inline size_t FindSegment(const T* starts, size_t count, T x) noexcept
+{
+    const T* base = starts;
+    size_t n = count;
+    while (n > 1U) {
+        const size_t half = n / 2U;
+        base = (base[half] <= x) ? base + half : base;   // compiles to a conditional move
+        n -= half;
+    }
+    return size_t(base - starts);
+}
+
+/**
+ * @brief `FindSegment` that tries `hint` and its successor before searching,
+ *        then stores the result back into `hint`.
+ */
+template <typename T>
+inline size_t FindSegment(const T* starts, size_t count, T x, SegmentHint& hint) noexcept
+{
+    size_t i = hint.index;
+    if (i < count && starts[i] <= x) {
+        if (i + 1U >= count || x < starts[i + 1U]) { return i; }
+        if (i + 2U >= count || x < starts[i + 2U]) { hint.index = i + 1U; return i + 1U; }
+    }
+    hint.index = FindSegment(starts, count, x);
+    return hint.index;
+}
+
+//==============================================================//
+/// UNIFORM GRID
+//==============================================================//
+
+/**
+ * @brief O(1) bucket lookup in front of the binary search.
+ *
+ * The span `[starts[0], xEnd]` is cut into `Buckets` equal buckets; for each
+ * bucket edge the grid records the segment containing it, so a query only
+ * looks at the segments between its bucket's two edges (usually one or two
+ * for evenly spread breakpoints).
+ *
+ * @tparam Buckets Number of buckets; 0 disables the grid (plain binary search).
+ */
+template <size_t Buckets>
+class UniformSegmentGrid {
+    static_assert(Buckets <= 0xFFFFU, "Bucket edges are stored as uint16_t.");
+
+public:
+    static constexpr bool Enabled = true;
+
+    /**
+     * @brief Rebuild the bucket table.
+     * @param starts Ascending segment starts.
+     * @param count  Number of starts (at most 65535).
+     * @param xEnd   End of the covered span (e.g. the last segment's xMax).
+     */
+    template <typename T>
+    void Build(const T* starts, size_t count, T xEnd) noexcept
+    {
+        count_ = count;
+        if (count == 0U) { return; }
+        origin_ = float(starts[0]);
+        const float span = float(xEnd) - origin_;
+        inverseWidth_ = (span > 0.0f) ? float(Buckets) / span : 0.0f;
+        const float width = (span > 0.0f) ? span / float(Buckets) : 0.0f;
+        for (size_t k = 0; k <= Buckets; ++k) {
+            edges_[k] = uint16_t(FindSegment(starts, count, T(origin_ + width * float(k))));
+        }
+    }
+
+    /// @brief Same result as `FindSegment(starts, count, x)`.
+    template <typename T>
+    size_t Find(const T* starts, size_t count, T x) const noexcept
+    {
+        if (count != count_ || count == 0U) { return count == 0U ? 0U : FindSegment(starts, count, x); }
+
+        float position = (float(x) - origin_) * inverseWidth_;
+        // Clamp in float before converting: size_t(+inf) or size_t(1e30f) is undefined.
+        position = position > 0.0f ? position : 0.0f;   // also maps NaN to bucket 0
+        position = position < float(Buckets - 1U) ? position : float(Buckets - 1U);
+        const size_t bucket = size_t(position);
+
+        // One branchless step covers the common case of at most one breakpoint per bucket.
+        size_t i = edges_[bucket];
+        const size_t next = (i + 1U < count) ? i + 1U : i;
+        i = (starts[next] <= x) ? next : i;
+        // Crowded buckets, and float rounding at a bucket edge, fall back to a short walk.
+        if (i + 1U < count && starts[i + 1U] <= x) {
+            const size_t lo = i + 1U;
+            size_t hi = edges_[bucket + 1U];
+            hi = hi < lo ? lo : hi;
+            i = lo + FindSegment(starts + lo, hi - lo + 1U, x);
+            while (i + 1U < count && starts[i + 1U] <= x) { ++i; }
+        }
+        while (i > 0U && x < starts[i]) { --i; }
+        return i;
+    }
+
+private:
+    float origin_ = 0.0f;
+    float inverseWidth_ = 0.0f;
+    size_t count_ = 0;
+    std::array<uint16_t, Buckets + 1U> edges_{};
+};
+
+/// Grid disabled: no storage, `Find` is a plain binary search.
+template <>
+class UniformSegmentGrid<0> {
+public:
+    static constexpr bool Enabled = false;
+
+    template <typename T>
+    void Build(const T*, size_t, T) noexcept {}
+
+    template <typename T>
+    size_t Find(const T* starts, size_t count, T x) const noexcept
+    {
+        return count == 0U ? 0U : FindSegment(starts, count, x);
+    }
+};
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_SEGMENTSEARCH_H_ */
@@ -0,0 +1,278 @@
+/**
+ * @file SplineCurve.h
+ * @brief Fixed-capacity monotone cubic (Fritsch–Carlson) and Akima spline
+ *        curves with precomputed coefficients.
+ *
+ * Smooth sensor characteristics need many `BoundedLinearCurve` segments for
+ * a given accuracy; a cubic Hermite spline through a handful of knots reaches
+ * the same error with far fewer points. Both curves here are C1 piecewise
+ * cubics that differ only in how the knot slopes are chosen:
+ *
+ * - `MonotoneCubicSpline`: Fritsch–Carlson / PCHIP slopes (weighted harmonic
+ *   mean, zero at local extrema, shape-preserving ends). Never overshoots, so
+ *   monotone data gives a monotone curve — the right default for calibration
+ *   tables.
+ * - `AkimaSpline`: Akima's locally weighted slopes. Follows the data more
+ *   closely than PCHIP on smooth non-monotone shapes and does not ring around
+ *   outliers, but may overshoot slightly.
+ *
+ * `SetKnots()` computes the per-interval coefficients once (in double);
+ * evaluation is a segment search from SegmentSearch.h (branchless binary
+ * search, optional uniform grid, optional caller hint) followed by a
+ * 3-multiply Horner step.
+ *
+ * ### Threading and allocation
+ * - No allocation. Evaluation is const and re-entrant; `SetKnots()` must
+ *   not run concurrently with evaluation.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_SPLINECURVE_H_
+#define HF_UTILS_GENERAL_SPLINECURVE_H_
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "SegmentSearch.h"
+
+namespace hf_utils {
+
+/**
+ * @brief Cubic Hermite spline storage and evaluation shared by the spline types.
+ *
+ * @tparam MaxKnots    Maximum number of knots (at least 2).
+ * @tparam GridBuckets Uniform-grid buckets for the interval search (0 = binary search only).
+ */
+template <size_t MaxKnots, size_t GridBuckets = 0>
+class HermiteSplineCurve {
+    static_assert(MaxKnots >= 2, "A spline needs at least two knots.");
+
+public:
+    /**
+     * @brief Value at `x`, with the same contract as `PiecewiseBoundedLinearCurve::CalculateY`.
+     * @return False (y untouched) if `x` is outside `[first knot, last knot]` or no knots are set.
+     */
+    bool CalculateY(float x, float& y) const noexcept
+    {
+        if (!InRange(x)) { return false; }
+        y = EvaluateInterval(grid_.Find(knotX_.data(), intervals_, x), x);
+        return true;
+    }
+
+    /**
+     * @brief `CalculateY` starting from the interval found by the previous call (slowly varying inputs).
+     */
+    bool CalculateY(float x, float& y, SegmentHint& hint) const noexcept
+    {
+        if (!InRange(x)) { return false; }
+        y = EvaluateInterval(FindSegment(knotX_.data(), intervals_, x, hint), x);
+        return true;
+    }
+
+    /**
+     * @brief Evaluate `n` inputs; out-of-range inputs get `fallback`.
+     * @return Number of inputs in range.
+     */
+    size_t CalculateY(const float* x, float* y, size_t n,
+                      float fallback = std::numeric_limits<float>::quiet_NaN()) const noexcept
+    {
+        size_t inRange = 0;
+        for (size_t i = 0; i < n; ++i) {
+            float value = fallback;
+            inRange += CalculateY(x[i], value) ? 1U : 0U;
+            y[i] = value;
+        }
+        return inRange;
+    }
+
+    /**
+     * @brief Value at `x` clamped to the knot range (0 if no knots are set).
+     */
+    float Evaluate(float x) const noexcept
+    {
+        if (intervals_ == 0U) { return 0.0f; }
+        x = x < knotX_[0] ? knotX_[0] : (x > xEnd_ ? xEnd_ : x);
+        return EvaluateInterval(grid_.Find(knotX_.data(), intervals_, x), x);
+    }
+
+    /// @return Number of knots currently set.
+    size_t KnotCount() const noexcept { return intervals_ == 0U ? 0U : intervals_ + 1U; }
+
+    /// @brief Removes all knots.
+    void Clear() noexcept { intervals_ = 0; }
+
+protected:
+    HermiteSplineCurve() = default;
+
+    /// Validate knots: at least two, at most MaxKnots, strictly increasing finite x.
+    static bool ValidKnots(const float* xs, const float* ys, size_t count) noexcept
+    {
+        if (xs == nullptr || ys == nullptr || count < 2U || count > MaxKnots) { return false; }
+        for (size_t i = 0; i < count; ++i) {
+            if (!std::isfinite(xs[i]) || !std::isfinite(ys[i])) { return false; }
+            if (i > 0U && !(xs[i] > xs[i - 1U])) { return false; }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Store knots and build the per-interval cubic coefficients from the knot slopes.
+     */
+    void Build(const float* xs, const float* ys, size_t count, const double* slopes) noexcept
+    {
+        intervals_ = count - 1U;
+        for (size_t k = 0; k < intervals_; ++k) {
+            const double h = double(xs[k + 1U]) - double(xs[k]);
+            const double delta = (double(ys[k + 1U]) - double(ys[k])) / h;
+            const double m0 = slopes[k];
+            const double m1 = slopes[k + 1U];
+            knotX_[k] = xs[k];
+            coefficients_[k] = { ys[k], float(m0), float((3.0 * delta - 2.0 * m0 - m1) / h),
+                                 float((m0 + m1 - 2.0 * delta) / (h * h)) };
+        }
+        knotX_[intervals_] = xs[intervals_];
+        xEnd_ = xs[intervals_];
+        grid_.Build(knotX_.data(), intervals_, xEnd_);
+    }
+
+private:
+    bool InRange(float x) const noexcept { return intervals_ != 0U && x >= knotX_[0] && x <= xEnd_; }
+
+    float EvaluateInterval(size_t k, float x) const noexcept
+    {
+        const std::array<float, 4>& c = coefficients_[k];
+        const float t = x - knotX_[k];
+        return c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+    }
+
+    std::array<float, MaxKnots> knotX_{};                              ///< Knot x values, ascending
+    std::array<std::array<float, 4>, MaxKnots - 1U> coefficients_{};  ///< y + m t + c2 t^2 + c3 t^3 per interval
+    size_t intervals_ = 0;                                             ///< Knot count - 1 (0 = empty)
+    float xEnd_ = 0.0f;                                                ///< Last knot x
+    UniformSegmentGrid<GridBuckets> grid_;
+};
+
+//==============================================================//
+/// MONOTONE CUBIC (FRITSCH–CARLSON)
+//==============================================================//
+
+/**
+ * @brief Shape-preserving (PCHIP) monotone cubic spline.
+ */
+template <size_t MaxKnots, size_t GridBuckets = 0>
+class MonotoneCubicSpline : public HermiteSplineCurve<MaxKnots, GridBuckets> {
+public:
+    MonotoneCubicSpline() = default;
+
+    /**
+     * @brief Replace the knots and precompute the coefficients.
+     * @param xs    Knot x values, strictly increasing.
+     * @param ys    Knot y values.
+     * @param count Number of knots, 2..MaxKnots.
+     * @return False (curve unchanged) if the knots are invalid.
+     */
+    bool SetKnots(const float* xs, const float* ys, size_t count) noexcept
+    {
+        if (!this->ValidKnots(xs, ys, count)) { return false; }
+
+        std::array<double, MaxKnots> h{};
+        std::array<double, MaxKnots> delta{};
+        for (size_t k = 0; k + 1U < count; ++k) {
+            h[k] = double(xs[k + 1U]) - double(xs[k]);
+            delta[k] = (double(ys[k + 1U]) - double(ys[k])) / h[k];
+        }
+
+        std::array<double, MaxKnots> m{};
+        if (count == 2U) {
+            m[0] = m[1] = delta[0];
+        } else {
+            for (size_t k = 1; k + 1U < count; ++k) {
+                // Weighted harmonic mean of the neighbouring secants; flat at local extrema.
+                if (delta[k - 1U] * delta[k] <= 0.0) {
+                    m[k] = 0.0;
+                } else {
+                    const double w1 = 2.0 * h[k] + h[k - 1U];
+                    const double w2 = h[k] + 2.0 * h[k - 1U];
+                    m[k] = (w1 + w2) / (w1 / delta[k - 1U] + w2 / delta[k]);
+                }
+            }
+            m[0] = EndSlope(h[0], h[1], delta[0], delta[1]);
+            m[count - 1U] = EndSlope(h[count - 2U], h[count - 3U], delta[count - 2U], delta[count - 3U]);
+        }
+
+        this->Build(xs, ys, count, m.data());
+        return true;
+    }
+
+private:
+    /// Shape-preserving one-sided three-point end slope.
+    static double EndSlope(double h0, double h1, double d0, double d1) noexcept
+    {
+        double slope = ((2.0 * h0 + h1) * d0 - h0 * d1) / (h0 + h1);
+        if (slope * d0 <= 0.0) {
+            slope = 0.0;
+        } else if (d0 * d1 <= 0.0 && std::fabs(slope) > std::fabs(3.0 * d0)) {
+            slope = 3.0 * d0;
+        }
+        return slope;
+    }
+};
+
+//==============================================================//
+/// AKIMA
+//==============================================================//
+
+/**
+ * @brief Akima spline: locally weighted knot slopes, robust to outliers.
+ */
+template <size_t MaxKnots, size_t GridBuckets = 0>
+class AkimaSpline : public HermiteSplineCurve<MaxKnots, GridBuckets> {
+public:
+    AkimaSpline() = default;
+
+    /**
+     * @brief Replace the knots and precompute the coefficients.
+     * @param xs    Knot x values, strictly increasing.
+     * @param ys    Knot y values.
+     * @param count Number of knots, 2..MaxKnots.
+     * @return False (curve unchanged) if the knots are invalid.
+     */
+    bool SetKnots(const float* xs, const float* ys, size_t count) noexcept
+    {
+        if (!this->ValidKnots(xs, ys, count)) { return false; }
+
+        // Secant slopes with two extrapolated values on each side: d[j + 2] is interval j.
+        std::array<double, MaxKnots + 3U> d{};
+        const size_t intervals = count - 1U;
+        for (size_t j = 0; j < intervals; ++j) {
+            d[j + 2U] = (double(ys[j + 1U]) - double(ys[j])) / (double(xs[j + 1U]) - double(xs[j]));
+        }
+        const double first = d[2];
+        const double second = (intervals > 1U) ? d[3] : first;
+        d[1] = 2.0 * first - second;
+        d[0] = 2.0 * d[1] - first;
+        const double last = d[intervals + 1U];
+        const double previous = (intervals > 1U) ? d[intervals] : last;
+        d[intervals + 2U] = 2.0 * last - previous;
+        d[intervals + 3U] = 2.0 * d[intervals + 2U] - last;
+
+        std::array<double, MaxKnots> m{};
+        for (size_t i = 0; i < count; ++i) {
+            // Knot i sits between intervals i - 1 (d[i + 1]) and i (d[i + 2]).
+            const double w1 = std::fabs(d[i + 3U] - d[i + 2U]);
+            const double w2 = std::fabs(d[i + 1U] - d[i]);
+            m[i] = (w1 + w2 > 0.0) ? (w1 * d[i + 1U] + w2 * d[i + 2U]) / (w1 + w2)
+                                   : 0.5 * (d[i + 1U] + d[i + 2U]);
+        }
+
+        this->Build(xs, ys, count, m.data());
+        return true;
+    }
+};
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_SPLINECURVE_H_ */
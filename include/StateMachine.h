@@ -64,6 +64,8 @@
 #include <cstddef>
 #include <cstdint>
 
+#include "Trace.h"
+
 namespace hf_utils {
 
 /**
@@ -369,6 +371,7 @@ public:
      */
     uint32_t Update(uint32_t now_ms, bool* stepped = nullptr) noexcept
     {
+        TRACE_SCOPE("StateMachine::Update");
         if (stepped) { *stepped = false; }
         bool attempted_entry_this_tick = false;
 
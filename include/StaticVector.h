@@ -0,0 +1,224 @@
+/**
+ * @file StaticVector.h
+ * @brief Fixed-capacity vector over uninitialized storage.
+ *
+ * Variant of `DynamicArray` for heavy or non-default-constructible element
+ * types. Storage is an aligned raw byte buffer: elements are constructed with
+ * placement new when appended or inserted and destroyed explicitly when
+ * removed or cleared, so construction cost is O(live elements) and unused
+ * capacity is never touched.
+ *
+ * The interface follows `DynamicArray` (`Append`, `emplace_back`, `Insert`,
+ * `Remove`, `ClearAll`, random-access iteration); iterators are plain
+ * pointers.
+ *
+ * ### Threading and allocation
+ * - No heap allocation. Not thread-safe.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_STATICVECTOR_H_
+#define HF_UTILS_GENERAL_STATICVECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "DynamicArray.h"
+
+namespace hf_utils {
+
+/**
+ * @brief Vector with inline capacity `MaxCount` and O(live) construction.
+ *
+ * @tparam DataType  Element type; only needs to be move or copy constructible.
+ * @tparam MaxCount  Maximum number of elements.
+ * @tparam CountType Type used to store the element count; defaults to the smallest type that fits MaxCount.
+ */
+template <typename DataType, size_t MaxCount, typename CountType = DynamicArrayCountType<MaxCount>>
+class StaticVector {
+    static_assert(MaxCount > 0, "MaxCount must be at least 1.");
+    static_assert(std::is_unsigned<CountType>::value, "CountType must be an unsigned integer type.");
+    static_assert(MaxCount <= std::numeric_limits<CountType>::max(), "CountType is too small for MaxCount.");
+
+public:
+    using value_type      = DataType;
+    using iterator        = DataType*;
+    using const_iterator  = const DataType*;
+
+    StaticVector() noexcept = default;
+
+    StaticVector(std::initializer_list<DataType> items)
+    {
+        for (const DataType& item : items) {
+            if (!Append(item)) { break; }   // Only copy as many elements as will fit
+        }
+    }
+
+    StaticVector(const StaticVector& other)
+    {
+        for (const DataType& item : other) { new (Slot(count_)) DataType(item); ++count_; }
+    }
+
+    /// Move constructor (moves the live elements; the source is left empty)
+    StaticVector(StaticVector&& other) noexcept(std::is_nothrow_move_constructible<DataType>::value)
+    {
+        for (DataType& item : other) { new (Slot(count_)) DataType(std::move(item)); ++count_; }
+        other.ClearAll();
+    }
+
+    StaticVector& operator=(const StaticVector& other)
+    {
+        if (this != &other) { AssignFrom(other.begin(), other.size()); }
+        return *this;
+    }
+
+    /// Move assignment (the source is left empty)
+    StaticVector& operator=(StaticVector&& other) noexcept(std::is_nothrow_move_assignable<DataType>::value &&
+                                                           std::is_nothrow_move_constructible<DataType>::value)
+    {
+        if (this != &other) {
+            AssignFrom(std::make_move_iterator(other.begin()), other.size());
+            other.ClearAll();
+        }
+        return *this;
+    }
+
+    ~StaticVector() { ClearAll(); }
+
+    bool Append(const DataType& item) { return emplace_back(item); }
+
+    bool Append(DataType&& item) { return emplace_back(std::move(item)); }
+
+    /**
+     * @brief Constructs an element in place from `args` in the next free slot.
+     * @return True if there was room, false otherwise (nothing is constructed).
+     */
+    template <typename... Args>
+    bool emplace_back(Args&&... args)
+    {
+        if (count_ >= MaxCount) { return false; }
+        new (Slot(count_)) DataType(std::forward<Args>(args)...);
+        ++count_;
+        return true;
+    }
+
+    /// @brief Destroys the last element (no-op when empty).
+    void pop_back() noexcept
+    {
+        if (count_ > 0) { Element(--count_)->~DataType(); }
+    }
+
+    /**
+     * @brief Removes the first element matching `condition`; the last element takes its place.
+     * @param condition Any callable `bool(const DataType&)`.
+     */
+    template <typename Predicate>
+    bool Remove(Predicate&& condition)
+    {
+        iterator it = std::find_if(begin(), end(), std::forward<Predicate>(condition));
+        if (it == end()) { return false; }
+        DataType* last = Element(count_ - 1U);
+        if (it != last) { *it = std::move(*last); }
+        pop_back();
+        return true;
+    }
+
+    bool Insert(size_t index, const DataType& item) { return Insert(index, DataType(item)); }
+
+    /**
+     * @brief Inserts `item` before position `index`, shifting only the live elements after it.
+     */
+    bool Insert(size_t index, DataType&& item)
+    {
+        if (index > count_ || count_ >= MaxCount) { return false; }
+        if (index == count_) { return emplace_back(std::move(item)); }
+
+        new (Slot(count_)) DataType(std::move(*Element(count_ - 1U)));
+        std::move_backward(begin() + index, end() - 1, end());
+        *Element(index) = std::move(item);
+        ++count_;
+        return true;
+    }
+
+    /// @brief Destroys every element.
+    void ClearAll() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible<DataType>::value) {
+            for (size_t i = 0; i < count_; ++i) { Element(i)->~DataType(); }
+        }
+        count_ = 0;
+    }
+
+    DataType& operator[](size_t index) noexcept { return *Element(index); }
+    const DataType& operator[](size_t index) const noexcept { return *Element(index); }
+
+    DataType& front() noexcept { return *Element(0); }
+    const DataType& front() const noexcept { return *Element(0); }
+    DataType& back() noexcept { return *Element(count_ - 1U); }
+    const DataType& back() const noexcept { return *Element(count_ - 1U); }
+
+    DataType* data() noexcept { return First(); }
+    const DataType* data() const noexcept { return First(); }
+
+    iterator begin() noexcept { return First(); }
+    iterator end() noexcept { return First() + count_; }
+    const_iterator begin() const noexcept { return First(); }
+    const_iterator end() const noexcept { return First() + count_; }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    size_t size() const noexcept { return count_; }
+    static constexpr size_t capacity() noexcept { return MaxCount; }
+    bool empty() const noexcept { return count_ == 0; }
+    bool full() const noexcept { return count_ == MaxCount; }
+
+private:
+    void* Slot(size_t index) noexcept { return storage_ + index * sizeof(DataType); }
+
+    DataType* Element(size_t index) noexcept
+    {
+        return std::launder(reinterpret_cast<DataType*>(storage_)) + index;
+    }
+
+    const DataType* Element(size_t index) const noexcept
+    {
+        return std::launder(reinterpret_cast<const DataType*>(storage_)) + index;
+    }
+
+    /// std::launder needs a live object at the address, so an empty vector hands out the plain storage pointer.
+    DataType* First() noexcept { return count_ != 0U ? Element(0) : reinterpret_cast<DataType*>(storage_); }
+    const DataType* First() const noexcept
+    {
+        return count_ != 0U ? Element(0) : reinterpret_cast<const DataType*>(storage_);
+    }
+
+    /**
+     * Assign over the common prefix, then destroy the excess or construct the extra elements.
+     * count_ grows with each construction, so if one throws the vector still owns exactly the
+     * elements that exist.
+     */
+    template <typename InputIt>
+    void AssignFrom(InputIt source, size_t sourceCount)
+    {
+        const size_t common = std::min<size_t>(count_, sourceCount);
+        for (size_t i = 0; i < common; ++i, ++source) { *Element(i) = *source; }
+        while (count_ > sourceCount) { pop_back(); }
+        for (; count_ < sourceCount; ++source) {
+            new (Slot(count_)) DataType(*source);
+            ++count_;
+        }
+    }
+
+    alignas(DataType) unsigned char storage_[sizeof(DataType) * MaxCount];
+    CountType count_ = 0;
+};
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_STATICVECTOR_H_ */
@@ -0,0 +1,237 @@
+/**
+ * @file StringViewUtils.h
+ * @brief Allocation-free `std::string_view` counterparts of the Utility.h
+ *        string helpers.
+ *
+ * - `StringSplitView(str, delim)`: lazy range of `std::string_view` tokens,
+ *   same token rules as `StringSplit()` (empty tokens are kept; an empty
+ *   input yields one empty token).
+ * - `StringTrimView(str)`: view with leading / trailing whitespace removed.
+ * - `StringToLowerInPlace()` / `StringToUpperInPlace()`: ASCII case folding
+ *   over a mutable buffer.
+ * - `FindChar(str, c, pos)`: delimiter scan, 16 bytes per step with SSE2 or
+ *   NEON when available.
+ *
+ * \code{.cpp}
+ * for (std::string_view field : hf_utils::StringSplitView(line, ',')) {
+ *     field = hf_utils::StringTrimView(field);
+ *     // ...
+ * }
+ * \endcode
+ *
+ * Views point into the caller's buffer and are only valid while it is.
+ * Whitespace and case folding are ASCII / "C" locale only, independent of
+ * the global locale.
+ *
+ * ### Threading and allocation
+ * - No allocation, no shared state.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_STRINGVIEWUTILS_H_
+#define HF_UTILS_GENERAL_STRINGVIEWUTILS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#include "BitOps.h"
+
+namespace hf_utils {
+
+/**
+ * @brief Index of the first `c` in `str` at or after `pos`.
+ *
+ * @return Index, or `std::string_view::npos` if not found.
+ */
+inline size_t FindChar(std::string_view str, char c, size_t pos = 0) noexcept
+{
+    const size_t n = str.size();
+    if (pos >= n) { return std::string_view::npos; }
+    const char* data = str.data();
+    size_t i = pos;
+
+#if defined(__SSE2__)
+    const __m128i needle = _mm_set1_epi8(c);
+    for (; i + 16U <= n; i += 16U) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+        if (mask != 0U) { return i + CountTrailingZeros(mask); }
+    }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    const uint8x16_t needle = vdupq_n_u8(static_cast<uint8_t>(c));
+    for (; i + 16U <= n; i += 16U) {
+        const uint8x16_t eq = vceqq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(data + i)), needle);
+        /// Narrow to 4 bits per byte so the match mask fits one 64-bit lane
+        const uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+        if (mask != 0U) { return i + CountTrailingZeros(mask) / 4U; }
+    }
+#endif
+
+    for (; i < n; ++i) {
+        if (data[i] == c) { return i; }
+    }
+    return std::string_view::npos;
+}
+
+/**
+ * @brief True for the "C" locale whitespace set (space, \\t, \\n, \\v, \\f, \\r).
+ */
+constexpr bool IsAsciiSpace(char c) noexcept
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+/**
+ * @brief View of `str` without leading and trailing whitespace.
+ */
+constexpr std::string_view StringTrimView(std::string_view str) noexcept
+{
+    size_t begin = 0;
+    size_t end = str.size();
+    while (begin < end && IsAsciiSpace(str[begin])) { ++begin; }
+    while (end > begin && IsAsciiSpace(str[end - 1U])) { --end; }
+    return str.substr(begin, end - begin);
+}
+
+/**
+ * @brief Lowercase ASCII letters of `data[0..length)` in place.
+ */
+inline void StringToLowerInPlace(char* data, size_t length) noexcept
+{
+    for (size_t i = 0; i < length; ++i) {
+        const unsigned char ch = static_cast<unsigned char>(data[i]);
+        /// Branch-free so the loop vectorises
+        data[i] = static_cast<char>(ch | (static_cast<unsigned char>(ch - 'A') < 26U ? 0x20U : 0U));
+    }
+}
+
+/**
+ * @brief Uppercase ASCII letters of `data[0..length)` in place.
+ */
+inline void StringToUpperInPlace(char* data, size_t length) noexcept
+{
+    for (size_t i = 0; i < length; ++i) {
+        const unsigned char ch = static_cast<unsigned char>(data[i]);
+        data[i] = static_cast<char>(ch & (static_cast<unsigned char>(ch - 'a') < 26U ? 0xDFU : 0xFFU));
+    }
+}
+
+/// @copydoc StringToLowerInPlace(char*, size_t)
+inline void StringToLowerInPlace(std::string& str) noexcept { StringToLowerInPlace(&str[0], str.size()); }
+
+/// @copydoc StringToUpperInPlace(char*, size_t)
+inline void StringToUpperInPlace(std::string& str) noexcept { StringToUpperInPlace(&str[0], str.size()); }
+
+/**
+ * @brief Lazy range of tokens of a string split on one delimiter.
+ *
+ * Produced by `StringSplitView()`; iterate with range-for.
+ */
+class SplitRange {
+public:
+    /**
+     * @brief Forward iterator yielding `std::string_view` tokens.
+     */
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::string_view;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const std::string_view*;
+        using reference         = const std::string_view&;
+
+        iterator() noexcept = default;
+
+        reference operator*() const noexcept { return token_; }
+        pointer operator->() const noexcept { return &token_; }
+
+        iterator& operator++() noexcept
+        {
+            if (next_ > str_.size()) {
+                done_ = true;
+            } else {
+                Load(next_);
+            }
+            return *this;
+        }
+
+        iterator operator++(int) noexcept
+        {
+            iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(const iterator& other) const noexcept
+        {
+            return done_ == other.done_ && (done_ || token_.data() == other.token_.data());
+        }
+        bool operator!=(const iterator& other) const noexcept { return !(*this == other); }
+
+    private:
+        friend class SplitRange;
+
+        iterator(std::string_view str, char delimiter) noexcept
+            : str_(str)
+            , delimiter_(delimiter)
+            , done_(false)
+        {
+            Load(0U);
+        }
+
+        void Load(size_t start) noexcept
+        {
+            const size_t end = FindChar(str_, delimiter_, start);
+            if (end == std::string_view::npos) {
+                token_ = str_.substr(start);
+                next_  = str_.size() + 1U; // past the end: last token
+            } else {
+                token_ = str_.substr(start, end - start);
+                next_  = end + 1U;
+            }
+        }
+
+        std::string_view str_{};
+        std::string_view token_{};
+        size_t next_{0};
+        char delimiter_{'\0'};
+        bool done_{true};
+    };
+
+    SplitRange(std::string_view str, char delimiter) noexcept
+        : str_(str)
+        , delimiter_(delimiter)
+    { }
+
+    iterator begin() const noexcept { return iterator(str_, delimiter_); }
+    iterator end() const noexcept { return iterator(); }
+
+private:
+    std::string_view str_;
+    char delimiter_;
+};
+
+/**
+ * @brief Split `str` on `delimiter` without allocating.
+ *
+ * @return Range of views into `str`, with the same tokens `StringSplit()` returns.
+ */
+inline SplitRange StringSplitView(std::string_view str, char delimiter) noexcept
+{
+    return SplitRange(str, delimiter);
+}
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_STRINGVIEWUTILS_H_ */
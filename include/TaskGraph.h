@@ -0,0 +1,235 @@
+/**
+ * @file TaskGraph.h
+ * @brief Fixed-size task dependency graph (DAG) with topological dispatch,
+ *        serial or on a `WorkStealingPool`.
+ *
+ * Pipelines such as sample → filter → monitor → publish are expressed as
+ * explicit predecessor edges rather than as colliding `TaskManager`
+ * priority numbers. Edges use the same bitmap convention as
+ * `StateMachine::SetTransitionMatrix`: bit `j` of `predecessors[i]` set means
+ * "node `i` runs only after node `j` completed this cycle". The table is a
+ * plain `std::array<uint64_t, N>` and can be `constexpr`.
+ *
+ * `Finalize()` topologically sorts the graph once (Kahn's algorithm) and
+ * rejects cycles. Each cycle then either:
+ * - `ExecuteCycle()` — runs nodes serially in topological order, or
+ * - `ExecuteCycle(pool)` — seeds the roots on a `WorkStealingPool` and
+ *   dispatches every node the moment its last predecessor finishes, so cycle
+ *   latency follows the critical path rather than the node count.
+ *
+ * ### Threading and allocation
+ * - No allocation after construction.
+ * - Single owner drives `Finalize()` / `ExecuteCycle()`; node bodies run on
+ *   the pool workers in the parallel form and must be safe to run
+ *   concurrently with any node they do not depend on.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_TASKGRAPH_H_
+#define HF_UTILS_GENERAL_TASKGRAPH_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "BitOps.h"
+#include "WorkStealingPool.h"
+
+namespace hf_utils {
+
+/**
+ * @brief Build a predecessor bitmap from node indices.
+ *
+ * \code{.cpp}
+ * constexpr std::array<uint64_t, 4> kDeps = {
+ *     0,                      // Sample
+ *     DependsOn(0),           // Filter  <- Sample
+ *     DependsOn(1),           // Monitor <- Filter
+ *     DependsOn(1, 2),        // Publish <- Filter, Monitor
+ * };
+ * \endcode
+ */
+template <typename... Indices>
+constexpr uint64_t DependsOn(Indices... indices) noexcept
+{
+    return (uint64_t{0} | ... | (uint64_t{1} << indices));
+}
+
+/**
+ * @brief Dependency graph over `N` nodes.
+ *
+ * @tparam N Number of nodes. Must be ≤ 64 (one predecessor bit per node).
+ */
+template <size_t N>
+class TaskGraph {
+public:
+    static_assert(N > 0,   "TaskGraph requires at least one node.");
+    static_assert(N <= 64, "TaskGraph supports at most 64 nodes.");
+
+    /**
+     * @brief Construct the graph; call `Finalize()` before executing.
+     *
+     * @param nodes        Node bodies, indexed by node id.
+     * @param predecessors Bit `j` of `predecessors[i]` = `i` depends on `j`.
+     */
+    TaskGraph(const std::array<std::function<void()>, N>& nodes,
+              const std::array<uint64_t, N>& predecessors) noexcept
+        : nodes_(nodes)
+        , predecessors_(predecessors)
+    { }
+
+    TaskGraph(const TaskGraph&)            = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+
+    /**
+     * @brief Validate the edges and compute the topological order.
+     *
+     * @return `false` if an edge references a node `>= N`, a node depends on
+     *         itself, or the graph contains a cycle. The graph cannot be
+     *         executed until `Finalize()` succeeds.
+     */
+    bool Finalize() noexcept
+    {
+        finalized_ = false;
+        const uint64_t valid = (N == 64) ? ~uint64_t{0} : ((uint64_t{1} << N) - 1U);
+
+        for (auto& s : successors_) { s = 0; }
+        for (size_t i = 0; i < N; ++i) {
+            if ((predecessors_[i] & ~valid) != 0U)              { return false; }
+            if ((predecessors_[i] & (uint64_t{1} << i)) != 0U)  { return false; }
+            uint64_t preds = predecessors_[i];
+            while (preds != 0U) {
+                successors_[CountTrailingZeros(preds)] |= (uint64_t{1} << i);
+                preds &= preds - 1U;
+            }
+        }
+
+        /// Kahn's algorithm; `done` doubles as the visited set
+        uint64_t done = 0;
+        size_t   emitted = 0;
+        std::array<uint32_t, N> depth{};
+        criticalPathDepth_ = 0;
+        while (emitted < N) {
+            uint64_t wave = 0;
+            for (size_t i = 0; i < N; ++i) {
+                const uint64_t bit = uint64_t{1} << i;
+                if ((done & bit) == 0U && (predecessors_[i] & ~done) == 0U) {
+                    wave |= bit;
+                }
+            }
+            if (wave == 0U) { return false; } // cycle
+
+            while (wave != 0U) {
+                const unsigned i = CountTrailingZeros(wave);
+                wave &= wave - 1U;
+                uint32_t d = 0;
+                uint64_t preds = predecessors_[i];
+                while (preds != 0U) {
+                    const unsigned p = CountTrailingZeros(preds);
+                    preds &= preds - 1U;
+                    if (depth[p] + 1U > d) { d = depth[p] + 1U; }
+                }
+                depth[i] = d;
+                if (d + 1U > criticalPathDepth_) { criticalPathDepth_ = d + 1U; }
+                order_[emitted++] = static_cast<uint8_t>(i);
+                done |= uint64_t{1} << i;
+            }
+        }
+
+        finalized_ = true;
+        return true;
+    }
+
+    /// @return `true` once `Finalize()` has succeeded.
+    bool IsFinalized() const noexcept { return finalized_; }
+
+    /// @return Node id at position `k` of the topological order.
+    size_t TopologicalOrder(size_t k) const noexcept { return order_[k]; }
+
+    /// @return Number of nodes on the longest dependency chain.
+    uint32_t CriticalPathDepth() const noexcept { return criticalPathDepth_; }
+
+    /**
+     * @brief Run every node once, serially, in topological order.
+     *
+     * @return `false` if the graph is not finalized.
+     */
+    bool ExecuteCycle() noexcept
+    {
+        if (!finalized_) { return false; }
+        for (size_t k = 0; k < N; ++k) {
+            nodes_[order_[k]]();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Run every node once on a worker pool, dispatching each node as
+     *        soon as all of its predecessors have completed.
+     *
+     * Blocks until the whole cycle has finished. The pool must be idle.
+     *
+     * @param pool Worker pool to run on.
+     * @return `false` if the graph is not finalized.
+     */
+    template <size_t MaxWorkers, size_t QueueCapacity>
+    bool ExecuteCycle(WorkStealingPool<MaxWorkers, QueueCapacity>& pool) noexcept
+    {
+        static_assert(QueueCapacity >= N, "Pool deques must be able to hold every node.");
+        if (!finalized_) { return false; }
+
+        size_t roots = 0;
+        for (size_t i = 0; i < N; ++i) {
+            remaining_[i].store(PopCount(predecessors_[i]), std::memory_order_relaxed);
+        }
+        for (size_t i = 0; i < N; ++i) {
+            if (predecessors_[i] == 0U) {
+                (void)pool.Enqueue(roots++, static_cast<uint32_t>(i));
+            }
+        }
+
+        ParallelContext<WorkStealingPool<MaxWorkers, QueueCapacity>> ctx{this, &pool};
+        pool.RunAndWait(&TaskGraph::RunNode<WorkStealingPool<MaxWorkers, QueueCapacity>>, &ctx);
+        return true;
+    }
+
+private:
+    template <typename Pool>
+    struct ParallelContext {
+        TaskGraph* graph;
+        Pool*      pool;
+    };
+
+    template <typename Pool>
+    static void RunNode(void* raw, uint32_t index) noexcept
+    {
+        auto* ctx = static_cast<ParallelContext<Pool>*>(raw);
+        TaskGraph& g = *ctx->graph;
+        g.nodes_[index]();
+
+        /// Release successors whose last input just completed
+        uint64_t succ = g.successors_[index];
+        while (succ != 0U) {
+            const unsigned s = CountTrailingZeros(succ);
+            succ &= succ - 1U;
+            if (g.remaining_[s].fetch_sub(1U, std::memory_order_acq_rel) == 1U) {
+                ctx->pool->Spawn(s);
+            }
+        }
+    }
+
+    std::array<std::function<void()>, N> nodes_;
+    std::array<uint64_t, N> predecessors_;
+    std::array<uint64_t, N> successors_{};
+    std::array<uint8_t, N>  order_{};
+    std::array<std::atomic<uint32_t>, N> remaining_{};
+    uint32_t criticalPathDepth_{0};
+    bool     finalized_{false};
+};
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_TASKGRAPH_H_ */
@@ -1,4 +1,27 @@
 /**
+ * @file TaskManager.h
+ * @brief Task structure with priority, predicate, and executor, plus a
+ *        fixed-size priority-ordered task manager.
+ *
+ * Two dispatch styles are supported side by side:
+ * - **Polling** (`ExecuteNextTask()` / `ExecuteAllNeededTasks()`): every
+ *   task's `needToDo` predicate is evaluated in priority order. Tasks with
+ *   an empty `needToDo` are skipped by the polling path.
+ * - **Event-driven** (`MarkReady()` + `ExecuteNextReadyTask()` /
+ *   `ExecuteAllReadyTasks()`): producers set a bit in an atomic ready mask;
+ *   the manager picks the highest-priority ready task with a single
+ *   count-trailing-zeros per 64 tasks and never calls `needToDo`.
+ *
+ * ### Threading and allocation
+ * - No allocation after construction (beyond whatever the `std::function`
+ *   members captured at construction).
+ * - `MarkReady()` / `ClearReady()` / `IsReady()` are lock-free and may be
+ *   called from any task or ISR-deferred context.
+ * - Per-task execution timing is opt-in: attach a `TaskRuntimeMonitor<N>`
+ *   with `AttachRuntimeMonitor()`.
+ * - The `Execute*` calls may race with each other only on the event-driven
+ *   path: each ready bit is claimed atomically, so a task runs once per
+ *   `MarkReady()`. The polling path is single-owner.
  *
  * @todo Add @copyright line once project copyright wording is finalised.
  */
@@ -9,14 +32,23 @@
 #include <functional>
 #include <array>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "BitOps.h"
+#include "TaskRuntimeMonitor.h"
+#include "Trace.h"
 
 /**
 * @brief Task structure to hold priority, checking function, and execution function.
 */
 struct Task {
    int priority;                        ///< Task priority (lower value means higher priority).
-   std::function<bool()> needToDo;      ///< Function to check if the task needs to be done.
+   std::function<bool()> needToDo;      ///< Function to check if the task needs to be done (optional for event-driven tasks).
    std::function<void()> execute;       ///< Function to execute the task.
+   const char* name = nullptr;          ///< Trace event name (string literal; optional).
 
    /**
     * @brief Comparison operator for sorting tasks by priority.
@@ -31,11 +63,18 @@ struct Task {
 /**
 * @brief TaskManager class to manage and execute tasks based on their priority.
 *
+* Tasks are stored sorted by priority (ties keep their construction order).
+* Event-driven calls address tasks by their index in the array passed to the
+* constructor, so producers never need to know the sorted layout.
+*
 * @tparam N The number of tasks.
 */
 template<size_t N>
 class TaskManager {
 public:
+   /// Number of 64-bit words in the ready mask.
+   static constexpr size_t kReadyWordCount = (N + 63U) / 64U;
+
    /**
     * @brief Constructor to initialize the TaskManager with a list of tasks.
     *
@@ -43,6 +82,9 @@ public:
     */
    TaskManager(const std::array<Task, N>& tasksArg) noexcept;
 
+   TaskManager(const TaskManager&)            = delete;
+   TaskManager& operator=(const TaskManager&) = delete;
+
    /**
     * @brief Execute the next highest priority task that needs to be done.
     *
@@ -57,21 +99,158 @@ public:
     */
    bool ExecuteAllNeededTasks() noexcept;
 
+   /**
+    * @brief Number of managed tasks.
+    */
+   static constexpr size_t Size() noexcept { return N; }
+
+   /**
+    * @brief Access a task by its sorted (priority-ordered) slot.
+    *
+    * Slot 0 is the highest-priority task. Used by external executors that
+    * dispatch tasks themselves.
+    *
+    * @param slot Sorted slot, must be `< N`.
+    * @return The task stored in that slot.
+    */
+   const Task& GetTask(size_t slot) const noexcept { return tasks[slot]; }
+
+   /**
+    * @brief Run the task in a sorted slot, recording its runtime if a
+    *        monitor is attached.
+    *
+    * All dispatch paths (and external executors) go through this call.
+    *
+    * @param slot Sorted slot, must be `< N`.
+    */
+   void ExecuteSlot(size_t slot) const noexcept;
+
+   /**
+    * @brief Attach (or detach with `nullptr`) per-task runtime accounting.
+    *
+    * Attach before dispatching starts; the monitor must outlive the manager
+    * or be detached first.
+    *
+    * @param monitor Monitor to record into, indexed by constructor index.
+    */
+   void AttachRuntimeMonitor(hf_utils::TaskRuntimeMonitor<N>* monitor) noexcept { monitor_ = monitor; }
+
+   //==============================================================//
+   /// EVENT-DRIVEN DISPATCH
+   //==============================================================//
+
+   /**
+    * @brief Flag a task as ready to run (lock-free, any context).
+    *
+    * @param taskIndex Index of the task in the constructor array. Out-of-range
+    *                  indices are ignored.
+    */
+   void MarkReady(size_t taskIndex) noexcept;
+
+   /**
+    * @brief Withdraw a pending ready flag without running the task.
+    *
+    * @param taskIndex Index of the task in the constructor array.
+    */
+   void ClearReady(size_t taskIndex) noexcept;
+
+   /**
+    * @brief Check whether a task currently has its ready flag set.
+    *
+    * @param taskIndex Index of the task in the constructor array.
+    * @return True if the task is flagged ready.
+    */
+   bool IsReady(size_t taskIndex) const noexcept;
+
+   /**
+    * @brief Check whether any task is flagged ready.
+    *
+    * @return True if at least one ready bit is set.
+    */
+   bool AnyReady() const noexcept;
+
+   /**
+    * @brief Claim and execute the highest-priority ready task.
+    *
+    * The ready bit is cleared before `execute` runs, so a producer marking
+    * the task again during execution queues one more run.
+    *
+    * @return True if a task was executed, false if none was ready.
+    */
+   bool ExecuteNextReadyTask() noexcept;
+
+   /**
+    * @brief Claim every currently-ready task and execute them in priority order.
+    *
+    * Tasks marked ready while this call is running are picked up on the
+    * next call.
+    *
+    * @return True if a task was executed, false otherwise.
+    */
+   bool ExecuteAllReadyTasks() noexcept;
+
 private:
-   std::array<Task, N> tasks; ///< Array to hold tasks.
+   /**
+    * @brief Map a constructor index to its ready-mask word and bit.
+    */
+   bool Locate(size_t taskIndex, size_t& word, uint64_t& bit) const noexcept;
+
+   std::array<Task, N> tasks;                               ///< Array to hold tasks, sorted by priority.
+   std::array<size_t, N> slotOf_{};                         ///< Constructor index -> sorted slot.
+   std::array<size_t, N> indexOf_{};                        ///< Sorted slot -> constructor index.
+   hf_utils::TaskRuntimeMonitor<N>* monitor_{nullptr};     ///< Optional runtime accounting.
+   std::array<std::atomic<uint64_t>, kReadyWordCount> ready_{}; ///< Bit `slot` set = task in that slot is ready.
 };
 
 template<size_t N>
-TaskManager<N>::TaskManager(const std::array<Task, N>& tasksArg) noexcept : tasks(tasksArg) {
-   /// Sort tasks by priority
-   std::sort(this->tasks.begin(), this->tasks.end());
+TaskManager<N>::TaskManager(const std::array<Task, N>& tasksArg) noexcept : tasks() {
+   /// Sort construction indices by priority; ties keep construction order
+   std::array<size_t, N> order{};
+   for (size_t i = 0; i < N; ++i) {
+       order[i] = i;
+   }
+   std::sort(order.begin(), order.end(), [&tasksArg](size_t a, size_t b) {
+       if (tasksArg[a].priority != tasksArg[b].priority) {
+           return tasksArg[a].priority < tasksArg[b].priority;
+       }
+       return a < b;
+   });
+
+   for (size_t slot = 0; slot < N; ++slot) {
+       tasks[slot] = tasksArg[order[slot]];
+       slotOf_[order[slot]] = slot;
+       indexOf_[slot] = order[slot];
+   }
+
+   for (auto& word : ready_) {
+       word.store(0U, std::memory_order_relaxed);
+   }
+}
+
+template<size_t N>
+void TaskManager<N>::ExecuteSlot(size_t slot) const noexcept {
+   /// Named tasks get their own trace event; unnamed ones are told apart by constructor index
+   TRACE_SCOPE(tasks[slot].name != nullptr ? tasks[slot].name : "TaskManager::ExecuteSlot");
+   if (tasks[slot].name == nullptr) {
+       TRACE_COUNTER("TaskManager::task_index", indexOf_[slot]);
+   }
+   if (monitor_ == nullptr) {
+       tasks[slot].execute();
+       return;
+   }
+   const auto start = std::chrono::steady_clock::now();
+   tasks[slot].execute();
+   const auto elapsed = std::chrono::steady_clock::now() - start;
+   monitor_->Record(indexOf_[slot],
+                    static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
 }
 
 template<size_t N>
 bool TaskManager<N>::ExecuteNextTask() noexcept {
-   for (const auto& task : tasks) {
-       if (task.needToDo()) {
-           task.execute();
+   for (size_t slot = 0; slot < N; ++slot) {
+       const Task& task = tasks[slot];
+       if (task.needToDo && task.needToDo()) {
+           ExecuteSlot(slot);
            return true; /// Return true if a task was executed
        }
    }
@@ -81,13 +260,97 @@ bool TaskManager<N>::ExecuteNextTask() noexcept {
 template<size_t N>
 bool TaskManager<N>::ExecuteAllNeededTasks() noexcept {
 	bool taskExecuted = false;
-   for (const auto& task : tasks) {
-       if (task.needToDo()) {
-           task.execute();
+   for (size_t slot = 0; slot < N; ++slot) {
+       const Task& task = tasks[slot];
+       if (task.needToDo && task.needToDo()) {
+           ExecuteSlot(slot);
            taskExecuted = true; /// Set to true if a task was executed
        }
    }
    return taskExecuted; /// Return false if no task was executed
 }
 
+template<size_t N>
+bool TaskManager<N>::Locate(size_t taskIndex, size_t& word, uint64_t& bit) const noexcept {
+   if (taskIndex >= N) {
+       return false;
+   }
+   const size_t slot = slotOf_[taskIndex];
+   word = slot / 64U;
+   bit  = uint64_t{1} << (slot % 64U);
+   return true;
+}
+
+template<size_t N>
+void TaskManager<N>::MarkReady(size_t taskIndex) noexcept {
+   size_t word = 0;
+   uint64_t bit = 0;
+   if (Locate(taskIndex, word, bit)) {
+       ready_[word].fetch_or(bit, std::memory_order_release);
+   }
+}
+
+template<size_t N>
+void TaskManager<N>::ClearReady(size_t taskIndex) noexcept {
+   size_t word = 0;
+   uint64_t bit = 0;
+   if (Locate(taskIndex, word, bit)) {
+       ready_[word].fetch_and(~bit, std::memory_order_relaxed);
+   }
+}
+
+template<size_t N>
+bool TaskManager<N>::IsReady(size_t taskIndex) const noexcept {
+   size_t word = 0;
+   uint64_t bit = 0;
+   if (Locate(taskIndex, word, bit)) {
+       return (ready_[word].load(std::memory_order_acquire) & bit) != 0U;
+   }
+   return false;
+}
+
+template<size_t N>
+bool TaskManager<N>::AnyReady() const noexcept {
+   for (const auto& word : ready_) {
+       if (word.load(std::memory_order_acquire) != 0U) {
+           return true;
+       }
+   }
+   return false;
+}
+
+template<size_t N>
+bool TaskManager<N>::ExecuteNextReadyTask() noexcept {
+   for (size_t w = 0; w < kReadyWordCount; ++w) {
+       uint64_t bits = ready_[w].load(std::memory_order_acquire);
+       while (bits != 0U) {
+           const uint64_t lowest = hf_utils::LowestSetBit(bits);
+           const uint64_t prev   = ready_[w].fetch_and(~lowest, std::memory_order_acq_rel);
+           if ((prev & lowest) != 0U) {
+               /// Lowest slot = highest priority, since tasks are sorted
+               ExecuteSlot(w * 64U + hf_utils::CountTrailingZeros(lowest));
+               return true;
+           }
+           /// Another consumer claimed it first; rescan what is left
+           bits = prev & ~lowest;
+       }
+   }
+   return false;
+}
+
+template<size_t N>
+bool TaskManager<N>::ExecuteAllReadyTasks() noexcept {
+   bool taskExecuted = false;
+   for (size_t w = 0; w < kReadyWordCount; ++w) {
+       uint64_t bits = ready_[w].exchange(0U, std::memory_order_acq_rel);
+       while (bits != 0U) {
+           const unsigned bitIndex = hf_utils::CountTrailingZeros(bits);
+           bits &= bits - 1U;
+           ExecuteSlot(w * 64U + bitIndex);
+           taskExecuted = true;
+       }
+   }
+   return taskExecuted;
+}
+
 #endif /* HF_UTILS_GENERAL_TASKMANAGER_H_ */
@@ -0,0 +1,108 @@
+/**
+ * @file TaskManagerExecutor.h
+ * @brief Host-side parallel executor that runs a `TaskManager`'s needed
+ *        tasks across a `WorkStealingPool`.
+ *
+ * `ExecuteAllNeededTasks()` evaluates every `needToDo` predicate on the
+ * calling thread in priority order (predicates are assumed cheap and are
+ * often not thread-safe), then spreads the tasks that need to run across
+ * the workers round-robin. Each worker's deque is seeded lowest-priority
+ * first, so its owner pops its share highest-priority first and the
+ * `WorkerCount()` highest-priority tasks are the first to start. Thieves
+ * take from the low-priority end of a busy sibling.
+ *
+ * Only use this for tasks whose `execute` bodies are safe to run
+ * concurrently with each other (e.g. telemetry packing, CRC, logging).
+ *
+ * ### Threading and allocation
+ * - Worker threads are created once in the constructor (see
+ *   `WorkStealingPool`). No allocation per call.
+ * - `ExecuteAllNeededTasks()` blocks until the batch completes and must be
+ *   called from one controlling thread.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_TASKMANAGEREXECUTOR_H_
+#define HF_UTILS_GENERAL_TASKMANAGEREXECUTOR_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "BitOps.h"
+#include "TaskManager.h"
+#include "WorkStealingPool.h"
+
+namespace hf_utils {
+
+/**
+ * @brief Runs the tasks of a `TaskManager<N>` in parallel on a worker pool.
+ *
+ * @tparam N          Task count of the bound manager.
+ * @tparam MaxWorkers Upper bound on worker threads.
+ */
+template <size_t N, size_t MaxWorkers = 8>
+class TaskManagerExecutor {
+public:
+    /// Worker pool type; each deque can hold every task.
+    using Pool = WorkStealingPool<MaxWorkers, static_cast<size_t>(NextPowerOfTwo(N))>;
+
+    /**
+     * @brief Bind to a task manager and start the workers.
+     *
+     * @param manager     Task manager to execute; must outlive the executor.
+     * @param workerCount Worker threads, `0` = hardware concurrency.
+     */
+    explicit TaskManagerExecutor(const TaskManager<N>& manager, size_t workerCount = 0)
+        : manager_(manager)
+        , pool_(workerCount)
+    { }
+
+    TaskManagerExecutor(const TaskManagerExecutor&)            = delete;
+    TaskManagerExecutor& operator=(const TaskManagerExecutor&) = delete;
+
+    /// @return Number of worker threads in use.
+    size_t WorkerCount() const noexcept { return pool_.WorkerCount(); }
+
+    /**
+     * @brief Parallel counterpart of `TaskManager::ExecuteAllNeededTasks()`.
+     *
+     * @return True if a task was executed, false otherwise.
+     */
+    bool ExecuteAllNeededTasks() noexcept
+    {
+        std::array<uint32_t, N> needed{};
+        size_t count = 0;
+        for (size_t slot = 0; slot < N; ++slot) {
+            const Task& task = manager_.GetTask(slot);
+            if (task.needToDo && task.needToDo()) {
+                needed[count++] = static_cast<uint32_t>(slot);
+            }
+        }
+        if (count == 0) {
+            return false;
+        }
+
+        /// Seed in reverse so each owner pops its highest-priority task first
+        const size_t workers = pool_.WorkerCount();
+        for (size_t i = count; i-- > 0;) {
+            (void)pool_.Enqueue(i % workers, needed[i]);
+        }
+        pool_.RunAndWait(&TaskManagerExecutor::RunSlot, this);
+        return true;
+    }
+
+private:
+    static void RunSlot(void* ctx, uint32_t slot) noexcept
+    {
+        static_cast<TaskManagerExecutor*>(ctx)->manager_.ExecuteSlot(slot);
+    }
+
+    const TaskManager<N>& manager_;
+    Pool                  pool_;
+};
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_TASKMANAGEREXECUTOR_H_ */
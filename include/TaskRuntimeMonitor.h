@@ -0,0 +1,192 @@
+/**
+ * @file TaskRuntimeMonitor.h
+ * @brief Opt-in per-task execution-time accounting for `TaskManager`.
+ *
+ * Attach a `TaskRuntimeMonitor<N>` to a `TaskManager<N>` with
+ * `AttachRuntimeMonitor()`; from then on every `execute` call is timed with
+ * `std::chrono::steady_clock` and recorded against the task's constructor
+ * index:
+ * - call count, cumulative / min / max / last execution time (ns),
+ * - a log2 latency histogram (`kTaskLatencyBuckets` buckets of µs),
+ * - an optional per-task budget; executions longer than the budget bump an
+ *   overrun counter.
+ *
+ * A manager without an attached monitor pays one null-pointer check per
+ * task execution and no storage.
+ *
+ * ### Threading and allocation
+ * - No allocation; storage is `std::array` of atomics.
+ * - Recording is lock-free and safe from several executing threads.
+ * - `Snapshot()` may be called from any thread (e.g. telemetry) without
+ *   locking. Each field is read atomically; fields of one snapshot may be
+ *   one execution apart from each other.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_TASKRUNTIMEMONITOR_H_
+#define HF_UTILS_GENERAL_TASKRUNTIMEMONITOR_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "BitOps.h"
+
+namespace hf_utils {
+
+/// Histogram buckets: `[0]` < 1 µs, `[k]` in `[2^(k-1), 2^k)` µs, last bucket open-ended.
+constexpr size_t kTaskLatencyBuckets = 20U;
+
+/**
+ * @brief Plain-value copy of one task's counters.
+ */
+struct TaskRuntimeStats {
+    uint32_t call_count{0};    ///< Completed executions.
+    uint32_t overrun_count{0}; ///< Executions that exceeded the budget.
+    uint64_t budget_ns{0};     ///< Configured budget (0 = none).
+    uint64_t total_ns{0};      ///< Sum of execution times.
+    uint64_t min_ns{0};        ///< Shortest execution (0 before the first call).
+    uint64_t max_ns{0};        ///< Longest execution.
+    uint64_t last_ns{0};       ///< Most recent execution.
+    std::array<uint32_t, kTaskLatencyBuckets> histogram{}; ///< Log2 µs latency histogram.
+
+    /// @return Mean execution time in ns, or 0 before the first call.
+    uint64_t MeanNs() const noexcept { return call_count ? total_ns / call_count : 0U; }
+};
+
+/**
+ * @brief Lock-free per-task runtime counters for `N` tasks.
+ *
+ * @tparam N Task count of the manager this monitor is attached to.
+ */
+template <size_t N>
+class TaskRuntimeMonitor {
+public:
+    TaskRuntimeMonitor() noexcept { Reset(); }
+
+    TaskRuntimeMonitor(const TaskRuntimeMonitor&)            = delete;
+    TaskRuntimeMonitor& operator=(const TaskRuntimeMonitor&) = delete;
+
+    /**
+     * @brief Set the execution budget of a task.
+     *
+     * @param taskIndex Constructor index of the task.
+     * @param budgetNs  Budget in ns; `0` disables overrun counting.
+     */
+    void SetBudgetNs(size_t taskIndex, uint64_t budgetNs) noexcept
+    {
+        if (taskIndex < N) {
+            entries_[taskIndex].budget_ns.store(budgetNs, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Record one execution (called by `TaskManager`).
+     *
+     * @param taskIndex Constructor index of the task.
+     * @param elapsedNs Measured execution time.
+     */
+    void Record(size_t taskIndex, uint64_t elapsedNs) noexcept
+    {
+        if (taskIndex >= N) { return; }
+        Entry& e = entries_[taskIndex];
+
+        e.total_ns.fetch_add(elapsedNs, std::memory_order_relaxed);
+        e.last_ns.store(elapsedNs, std::memory_order_relaxed);
+
+        uint64_t seen = e.min_ns.load(std::memory_order_relaxed);
+        while (elapsedNs < seen &&
+               !e.min_ns.compare_exchange_weak(seen, elapsedNs, std::memory_order_relaxed)) { }
+        seen = e.max_ns.load(std::memory_order_relaxed);
+        while (elapsedNs > seen &&
+               !e.max_ns.compare_exchange_weak(seen, elapsedNs, std::memory_order_relaxed)) { }
+
+        e.histogram[BucketOf(elapsedNs)].fetch_add(1U, std::memory_order_relaxed);
+
+        const uint64_t budget = e.budget_ns.load(std::memory_order_relaxed);
+        if (budget != 0U && elapsedNs > budget) {
+            e.overrun_count.fetch_add(1U, std::memory_order_relaxed);
+        }
+        e.call_count.fetch_add(1U, std::memory_order_release);
+    }
+
+    /**
+     * @brief Copy one task's counters.
+     *
+     * @param taskIndex Constructor index of the task.
+     * @return Counters (zeroed if `taskIndex` is out of range).
+     */
+    TaskRuntimeStats Snapshot(size_t taskIndex) const noexcept
+    {
+        TaskRuntimeStats s{};
+        if (taskIndex >= N) { return s; }
+        const Entry& e = entries_[taskIndex];
+
+        s.call_count    = e.call_count.load(std::memory_order_acquire);
+        s.overrun_count = e.overrun_count.load(std::memory_order_relaxed);
+        s.budget_ns     = e.budget_ns.load(std::memory_order_relaxed);
+        s.total_ns      = e.total_ns.load(std::memory_order_relaxed);
+        s.last_ns       = e.last_ns.load(std::memory_order_relaxed);
+        s.max_ns        = e.max_ns.load(std::memory_order_relaxed);
+        const uint64_t minNs = e.min_ns.load(std::memory_order_relaxed);
+        s.min_ns        = (minNs == kNoMin) ? 0U : minNs;
+        for (size_t b = 0; b < kTaskLatencyBuckets; ++b) {
+            s.histogram[b] = e.histogram[b].load(std::memory_order_relaxed);
+        }
+        return s;
+    }
+
+    /// @return Total overruns across all tasks.
+    uint32_t TotalOverruns() const noexcept
+    {
+        uint32_t total = 0;
+        for (const auto& e : entries_) { total += e.overrun_count.load(std::memory_order_relaxed); }
+        return total;
+    }
+
+    /**
+     * @brief Zero every counter. Budgets are preserved.
+     */
+    void Reset() noexcept
+    {
+        for (auto& e : entries_) {
+            e.call_count.store(0U, std::memory_order_relaxed);
+            e.overrun_count.store(0U, std::memory_order_relaxed);
+            e.total_ns.store(0U, std::memory_order_relaxed);
+            e.min_ns.store(kNoMin, std::memory_order_relaxed);
+            e.max_ns.store(0U, std::memory_order_relaxed);
+            e.last_ns.store(0U, std::memory_order_relaxed);
+            for (auto& b : e.histogram) { b.store(0U, std::memory_order_relaxed); }
+        }
+    }
+
+private:
+    static constexpr uint64_t kNoMin = ~uint64_t{0};
+
+    static size_t BucketOf(uint64_t elapsedNs) noexcept
+    {
+        const uint64_t us = elapsedNs / 1000U;
+        if (us == 0U) { return 0U; }
+        const size_t bucket = MostSignificantBit(us) + 1U;
+        return (bucket < kTaskLatencyBuckets) ? bucket : (kTaskLatencyBuckets - 1U);
+    }
+
+    struct Entry {
+        std::atomic<uint32_t> call_count{0};
+        std::atomic<uint32_t> overrun_count{0};
+        std::atomic<uint64_t> budget_ns{0};
+        std::atomic<uint64_t> total_ns{0};
+        std::atomic<uint64_t> min_ns{kNoMin};
+        std::atomic<uint64_t> max_ns{0};
+        std::atomic<uint64_t> last_ns{0};
+        std::array<std::atomic<uint32_t>, kTaskLatencyBuckets> histogram{};
+    };
+
+    std::array<Entry, N> entries_{};
+};
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_TASKRUNTIMEMONITOR_H_ */
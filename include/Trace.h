@@ -0,0 +1,337 @@
+/**
+ * @file Trace.h
+ * @brief Compile-time removable trace instrumentation with Chrome trace JSON export.
+ *
+ * Instrument code with:
+ * - `TRACE_SCOPE("name")`: one complete ("X") event covering the enclosing scope.
+ * - `TRACE_COUNTER("name", value)`: one counter ("C") sample.
+ *
+ * Unless `HF_UTILS_TRACE_ENABLED` is defined (to a non-zero value) before the
+ * first include, both macros expand to nothing, so instrumented code costs
+ * exactly zero in normal builds.
+ *
+ * When enabled, each thread writes fixed-size `TraceRecord`s into its own
+ * single-producer / single-consumer ring, claimed from a fixed registry on
+ * the thread's first event and cached in a `thread_local` pointer. A scope
+ * event is two `CycleClock::Now()` reads, one TLS load, one 32-byte store
+ * and a release store of the ring head; records keep raw ticks and are
+ * converted to nanoseconds only when flushed. The producer caches the ring
+ * tail, so it touches the flusher's cache line only when the ring looks
+ * full. No locks, no allocation. When a ring is full, new events are dropped
+ * and counted.
+ *
+ * `TraceFlushChromeJson(sink)` drains every ring (from any one thread) and
+ * streams a `{"traceEvents":[...]}` document to `sink(const char*, size_t)`.
+ * The output loads in `chrome://tracing` and in the Perfetto UI.
+ *
+ * \code{.cpp}
+ * #define HF_UTILS_TRACE_ENABLED 1
+ * #include "Trace.h"
+ *
+ * void ControlLoop() {
+ *     TRACE_SCOPE("ControlLoop");
+ *     TRACE_COUNTER("pressure_pa", pressure);
+ * }
+ *
+ * hf_utils::TraceFlushChromeJson([&](const char* data, size_t len) { file.write(data, len); });
+ * \endcode
+ *
+ * ### Configuration
+ * - `HF_UTILS_TRACE_MAX_THREADS` (default 16): registry slots. Threads that
+ *   start tracing after all slots are taken are not traced. Slots are not
+ *   recycled when a thread exits.
+ * - `HF_UTILS_TRACE_RING_CAPACITY` (default 4096, power of two): records
+ *   per thread.
+ *
+ * ### Threading and allocation
+ * - Ring storage is one static array sized by the two macros above.
+ * - Event names must be string literals (only the pointer is stored).
+ * - Only one thread may flush at a time.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_TRACE_H_
+#define HF_UTILS_GENERAL_TRACE_H_
+
+#if defined(HF_UTILS_TRACE_ENABLED) && HF_UTILS_TRACE_ENABLED
+
+#include <array>
+#include <atomic>
+#include <cinttypes>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "HighResolutionClock.h"
+
+#ifndef HF_UTILS_TRACE_MAX_THREADS
+#define HF_UTILS_TRACE_MAX_THREADS 16
+#endif
+
+#ifndef HF_UTILS_TRACE_RING_CAPACITY
+#define HF_UTILS_TRACE_RING_CAPACITY 4096
+#endif
+
+namespace hf_utils {
+
+/// Registry slots (one per traced thread).
+constexpr size_t kTraceMaxThreads = HF_UTILS_TRACE_MAX_THREADS;
+/// Records per thread ring.
+constexpr size_t kTraceRingCapacity = HF_UTILS_TRACE_RING_CAPACITY;
+
+static_assert(kTraceRingCapacity >= 2U && (kTraceRingCapacity & (kTraceRingCapacity - 1U)) == 0U,
+              "HF_UTILS_TRACE_RING_CAPACITY must be a power of two.");
+
+/**
+ * @brief Kind of a trace record.
+ */
+enum class TraceKind : uint32_t {
+    Complete = 0, ///< Scope with start and duration ("X").
+    Counter,      ///< Counter sample ("C").
+};
+
+/**
+ * @brief One fixed-size trace record.
+ */
+struct TraceRecord {
+    const char* name;   ///< String literal.
+    uint64_t    start;  ///< `CycleClock` ticks.
+    int64_t     value;  ///< Duration in ticks (`Complete`) or sample (`Counter`).
+    TraceKind   kind;
+};
+
+/**
+ * @brief Single-producer / single-consumer record ring owned by one thread.
+ */
+class TraceRing {
+public:
+    /**
+     * @brief Append a record (owning thread only).
+     */
+    void Push(const TraceRecord& record) noexcept
+    {
+        // The producer keeps its own copy of the tail and only re-reads the
+        // consumer's cache line when the ring looks full.
+        const uint32_t head = head_.load(std::memory_order_relaxed);
+        if (head - tailCache_ >= kTraceRingCapacity) {
+            tailCache_ = tail_.load(std::memory_order_acquire);
+            if (head - tailCache_ >= kTraceRingCapacity) {
+                dropped_.store(dropped_.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+                return;
+            }
+        }
+        records_[head & (kTraceRingCapacity - 1U)] = record;
+        head_.store(head + 1U, std::memory_order_release);
+    }
+
+    /**
+     * @brief Remove the oldest record (flushing thread only).
+     *
+     * @return False if the ring is empty.
+     */
+    bool Pop(TraceRecord& out) noexcept
+    {
+        const uint32_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire)) { return false; }
+        out = records_[tail & (kTraceRingCapacity - 1U)];
+        tail_.store(tail + 1U, std::memory_order_release);
+        return true;
+    }
+
+    /// @return Records dropped because the ring was full.
+    uint32_t Dropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    // Producer line: head, cached tail and drop count; consumer line: tail.
+    alignas(64) std::atomic<uint32_t> head_{0};
+    uint32_t                          tailCache_{0};
+    std::atomic<uint32_t>             dropped_{0};
+    alignas(64) std::atomic<uint32_t> tail_{0};
+    alignas(64) std::array<TraceRecord, kTraceRingCapacity> records_{};
+};
+
+/**
+ * @brief Fixed table of per-thread rings.
+ */
+class TraceRegistry {
+public:
+    /// @return Process-wide registry.
+    static TraceRegistry& Instance() noexcept
+    {
+        static TraceRegistry registry;
+        return registry;
+    }
+
+    /**
+     * @brief The calling thread's ring, claiming a slot on first use.
+     *
+     * @return Null if every slot is taken.
+     */
+    static TraceRing* ThisThreadRing() noexcept
+    {
+        TraceRing* ring = tlsRing_;
+        return (ring != nullptr) ? ring : Instance().ClaimThisThread();
+    }
+
+    /// @return Number of claimed slots.
+    size_t ThreadCount() const noexcept
+    {
+        const size_t claimed = claimed_.load(std::memory_order_acquire);
+        return (claimed < kTraceMaxThreads) ? claimed : kTraceMaxThreads;
+    }
+
+    /// @return Ring of slot `index` (`index < ThreadCount()`).
+    TraceRing& Ring(size_t index) noexcept { return rings_[index]; }
+
+    /// @return Tick count taken when the registry was created (timeline origin).
+    uint64_t OriginTicks() const noexcept { return origin_; }
+
+private:
+    TraceRegistry() noexcept : origin_(CycleClock::Now()) { }
+
+    /// Slow path of `ThisThreadRing()`: runs once per thread (every time for threads that found no slot).
+    TraceRing* ClaimThisThread() noexcept
+    {
+        if (tlsClaimed_) { return nullptr; }
+        tlsClaimed_ = true;
+        const size_t index = claimed_.fetch_add(1U, std::memory_order_acq_rel);
+        tlsRing_ = (index < kTraceMaxThreads) ? &rings_[index] : nullptr;
+        return tlsRing_;
+    }
+
+    std::atomic<size_t> claimed_{0};
+    const uint64_t      origin_;
+    std::array<TraceRing, kTraceMaxThreads> rings_{};
+
+    // Constant-initialised, so the per-event lookup is a plain TLS load with no guard.
+    static inline thread_local TraceRing* tlsRing_    = nullptr;
+    static inline thread_local bool       tlsClaimed_ = false;
+};
+
+/**
+ * @brief Emit a counter sample.
+ */
+inline void TraceCounter(const char* name, int64_t value) noexcept
+{
+    TraceRing* ring = TraceRegistry::ThisThreadRing();
+    if (ring != nullptr) { ring->Push(TraceRecord{name, CycleClock::Now(), value, TraceKind::Counter}); }
+}
+
+/**
+ * @brief RAII scope: emits one `Complete` record on destruction.
+ *
+ * The ring is looked up before the start stamp is taken, so the registry's
+ * timeline origin always precedes the first event.
+ */
+class TraceScope {
+public:
+    explicit TraceScope(const char* name) noexcept
+        : ring_(TraceRegistry::ThisThreadRing())
+        , name_(name)
+        , start_(CycleClock::Now())
+    { }
+
+    ~TraceScope()
+    {
+        if (ring_ != nullptr) {
+            ring_->Push(TraceRecord{name_, start_, static_cast<int64_t>(CycleClock::Now() - start_),
+                                    TraceKind::Complete});
+        }
+    }
+
+    TraceScope(const TraceScope&)            = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    TraceRing*  ring_;
+    const char* name_;
+    uint64_t    start_;
+};
+
+/**
+ * @brief Drain every ring into a Chrome trace JSON document.
+ *
+ * @param sink Callable `void(const char* data, size_t len)` receiving the
+ *             document in pieces.
+ * @return Number of records written.
+ */
+template <typename Sink>
+size_t TraceFlushChromeJson(Sink&& sink)
+{
+    TraceRegistry& registry = TraceRegistry::Instance();
+    const uint64_t origin = registry.OriginTicks();
+    char buffer[160];
+    size_t written = 0;
+
+    static constexpr char kHeader[] = "{\"traceEvents\":[";
+    sink(kHeader, sizeof(kHeader) - 1U);
+
+    const size_t threads = registry.ThreadCount();
+    for (size_t tid = 0; tid < threads; ++tid) {
+        TraceRing& ring = registry.Ring(tid);
+        TraceRecord r{};
+        while (ring.Pop(r)) {
+            const uint64_t tsNs = CycleClock::TicksToNs(r.start - origin);
+            int len = 0;
+            if (r.kind == TraceKind::Complete) {
+                const uint64_t durNs = CycleClock::TicksToNs(static_cast<uint64_t>(r.value));
+                len = std::snprintf(buffer, sizeof(buffer),
+                                    "%s{\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%" PRIu64 ".%03u,\"dur\":%" PRIu64 ".%03u,\"name\":\"",
+                                    (written != 0U) ? "," : "", static_cast<unsigned>(tid),
+                                    tsNs / 1000U, static_cast<unsigned>(tsNs % 1000U),
+                                    durNs / 1000U, static_cast<unsigned>(durNs % 1000U));
+            } else {
+                len = std::snprintf(buffer, sizeof(buffer),
+                                    "%s{\"ph\":\"C\",\"pid\":1,\"tid\":%u,\"ts\":%" PRIu64 ".%03u,\"args\":{\"value\":%" PRId64 "},\"name\":\"",
+                                    (written != 0U) ? "," : "", static_cast<unsigned>(tid),
+                                    tsNs / 1000U, static_cast<unsigned>(tsNs % 1000U), r.value);
+            }
+            sink(buffer, static_cast<size_t>(len));
+
+            /// Names are literals, but escape the two characters JSON requires anyway
+            const char* start = r.name;
+            const char* p = r.name;
+            for (; *p != '\0'; ++p) {
+                if (*p == '"' || *p == '\\') {
+                    sink(start, static_cast<size_t>(p - start));
+                    sink("\\", 1U);
+                    start = p;
+                }
+            }
+            sink(start, static_cast<size_t>(p - start));
+            sink("\"}", 2U);
+            ++written;
+        }
+    }
+
+    uint64_t dropped = 0;
+    for (size_t tid = 0; tid < threads; ++tid) { dropped += registry.Ring(tid).Dropped(); }
+    const int len = std::snprintf(buffer, sizeof(buffer),
+                                  "],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_events\":%" PRIu64 "}}",
+                                  dropped);
+    sink(buffer, static_cast<size_t>(len));
+    return written;
+}
+
+} // namespace hf_utils
+
+#define HF_UTILS_TRACE_CONCAT_IMPL(a, b) a##b
+#define HF_UTILS_TRACE_CONCAT(a, b)      HF_UTILS_TRACE_CONCAT_IMPL(a, b)
+
+/// Trace the enclosing scope as one complete event.
+#define TRACE_SCOPE(name) \
+    ::hf_utils::TraceScope HF_UTILS_TRACE_CONCAT(hfTraceScope_, __LINE__)(name)
+
+/// Record a counter sample.
+#define TRACE_COUNTER(name, value) \
+    ::hf_utils::TraceCounter((name), static_cast<int64_t>(value))
+
+#else /* tracing disabled */
+
+#define TRACE_SCOPE(name)          do { } while (0)
+#define TRACE_COUNTER(name, value) do { } while (0)
+
+#endif /* HF_UTILS_TRACE_ENABLED */
+
+#endif /* HF_UTILS_GENERAL_TRACE_H_ */
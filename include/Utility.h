@@ -11,6 +11,7 @@
 #ifndef UTILITY_H_
 #define UTILITY_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <algorithm>
 #include <functional>
@@ -19,6 +20,8 @@
 #include <atomic>
 #include <chrono>
 
+#include "PreciseDelay.h"
+
 constexpr uint32_t NO_WAIT = 0u;
 
 inline uint32_t GetElapsedTimeMsec()
@@ -28,10 +31,15 @@ inline uint32_t GetElapsedTimeMsec()
     return static_cast<uint32_t>(duration_cast<milliseconds>(steady_clock::now() - start).count());
 }
 
+/**
+ * @brief Block for `msec` milliseconds.
+ *
+ * Sleeps for most of the wait and spins only for the final stretch; see
+ * PreciseDelay.h for µs / ns and absolute-deadline variants.
+ */
 inline void DelayMsec(uint32_t msec)
 {
-    const auto end = GetElapsedTimeMsec() + msec;
-    while (GetElapsedTimeMsec() < end) {}
+    hf_utils::PreciseDelay(std::chrono::milliseconds(msec));
 }
 
 enum TimeUnit {
@@ -82,6 +90,7 @@ enum temp_unit_id_t {
  *
  * @param str The input string to be converted.
  * @return A new string with all characters in lowercase.
+ * @see hf_utils::StringToLowerInPlace (StringViewUtils.h) to fold a buffer without copying.
  */
 std::string StringToLower(const std::string& str);
 
@@ -92,6 +101,7 @@ std::string StringToLower(const std::string& str);
  *
  * @param str The input string to be converted.
  * @return A new string with all characters in uppercase.
+ * @see hf_utils::StringToUpperInPlace (StringViewUtils.h) to fold a buffer without copying.
  */
 std::string StringToUpper(const std::string& str);
 
@@ -102,6 +112,7 @@ std::string StringToUpper(const std::string& str);
  *
  * @param str The input string to be trimmed.
  * @return A new string with leading and trailing whitespace removed.
+ * @see hf_utils::StringTrimView (StringViewUtils.h) for a non-allocating view.
  */
 std::string StringTrim(const std::string& str);
 
@@ -113,6 +124,7 @@ std::string StringTrim(const std::string& str);
  * @param str The input string to be split.
  * @param delimiter The character used to split the string.
  * @return A vector of substrings.
+ * @see hf_utils::StringSplitView (StringViewUtils.h) for a lazy, non-allocating split.
  */
 std::vector<std::string> StringSplit(const std::string& str, char delimiter);
 #endif
@@ -141,6 +153,23 @@ std::vector<std::string> StringSplit(const std::string& str, char delimiter);
      */
     bool ConvertTime(float inputValue, TimeUnit inputUnit, float &outputValue, TimeUnit outputUnit);
 
+    /**
+     * @brief Converts an array of time values from one unit to another.
+     *
+     * The unit pair is folded into a single scale factor once, then applied to
+     * every sample with a SIMD loop (no per-sample branches or divides). Results
+     * can differ from ConvertTime() in the last bit.
+     *
+     * @param in Input values.
+     * @param[out] out Converted values; may be the same array as `in`.
+     * @param count Number of values.
+     * @param inputUnit The unit of the input values.
+     * @param outputUnit The desired output unit.
+     *
+     * @return Returns false, without writing `out`, if either unit is not recognized.
+     */
+    bool ConvertTimes(const float* in, float* out, size_t count, TimeUnit inputUnit, TimeUnit outputUnit);
+
 #endif /* TIME_CONVERSION_H */
 
 #ifndef PRESSURE_CONVERSION_H
@@ -170,6 +199,22 @@ std::vector<std::string> StringSplit(const std::string& str, char delimiter);
 	 */
     bool ConvertPressureUnit(float pressure, pressure_unit_id_t fromUnit, float &outputValue, pressure_unit_id_t toUnit);
 
+    /**
+     * @brief Converts an array of pressures from one unit to another.
+     *
+     * Batch counterpart of ConvertPressureUnit(): one precomputed scale factor,
+     * applied with a SIMD loop. Results can differ in the last bit.
+     *
+     * @param in Input pressures.
+     * @param[out] out Converted pressures; may be the same array as `in`.
+     * @param count Number of values.
+     * @param fromUnit Unit ID of the input pressures.
+     * @param toUnit Unit ID to convert the pressures to.
+     *
+     * @return Returns false, without writing `out`, if either unit is not recognized.
+     */
+    bool ConvertPressureUnits(const float* in, float* out, size_t count, pressure_unit_id_t fromUnit, pressure_unit_id_t toUnit);
+
 #endif /* PRESSURE_CONVERSION_H */
 
 #ifndef FLOW_CONVERSION_H
@@ -199,6 +244,22 @@ std::vector<std::string> StringSplit(const std::string& str, char delimiter);
      */
     bool ConvertFlowUnit(float flow, flow_unit_id_t fromUnit, float &outputValue, flow_unit_id_t toUnit);
 
+    /**
+     * @brief Converts an array of flows from one unit to another.
+     *
+     * Batch counterpart of ConvertFlowUnit(): one precomputed scale factor,
+     * applied with a SIMD loop. Results can differ in the last bit.
+     *
+     * @param in Input flows.
+     * @param[out] out Converted flows; may be the same array as `in`.
+     * @param count Number of values.
+     * @param fromUnit Unit ID of the input flows.
+     * @param toUnit Unit ID to convert the flows to.
+     *
+     * @return Returns false, without writing `out`, if either unit is not recognized.
+     */
+    bool ConvertFlowUnits(const float* in, float* out, size_t count, flow_unit_id_t fromUnit, flow_unit_id_t toUnit);
+
 #endif /* FLOW_CONVERSION_H */
 
 #ifndef TEMPERATURE_CONVERSION_H
@@ -228,6 +289,23 @@ std::vector<std::string> StringSplit(const std::string& str, char delimiter);
 	 */
     bool ConvertTemperatureUnit(float temp, temp_unit_id_t fromUnit, float &outputValue, temp_unit_id_t toUnit);
 
+    /**
+     * @brief Converts an array of temperatures from one unit to another.
+     *
+     * Batch counterpart of ConvertTemperatureUnit(): the unit pair is folded
+     * into one scale / offset pair, applied with a SIMD multiply-add loop.
+     * Results can differ in the last bit.
+     *
+     * @param in Input temperatures.
+     * @param[out] out Converted temperatures; may be the same array as `in`.
+     * @param count Number of values.
+     * @param fromUnit Unit ID of the input temperatures.
+     * @param toUnit Unit ID to convert the temperatures to.
+     *
+     * @return Returns false, without writing `out`, if either unit is not recognized.
+     */
+    bool ConvertTemperatureUnits(const float* in, float* out, size_t count, temp_unit_id_t fromUnit, temp_unit_id_t toUnit);
+
 #endif /* TEMPERATURE_CONVERSION_H */
 
 
@@ -246,6 +324,24 @@ std::vector<std::string> StringSplit(const std::string& str, char delimiter);
      * @return bool True if logic produced the expected result within the timeout, false otherwise.
      */
     bool TestLogicWithTimeout(const std::function<bool()>& logic, bool expected, uint32_t timeoutMs, uint32_t timeBetweenChecksMs, uint32_t* pTimeTakenSaver=nullptr);
+
+    namespace hf_utils { class WaitableCondition; }
+
+    /**
+     * @brief Event-driven variant: wait on a condition signalled by the producer instead of polling.
+     *
+     * The logic is re-evaluated only when the producer calls `condition.Notify()`,
+     * so the call returns as soon as the logic flips and uses no CPU in between.
+     *
+     * @param condition Condition the producer notifies after changing the state `logic` reads (see WaitableCondition.h).
+     * @param logic The logic to test, should return a bool.
+     * @param expected The expected result, true or false.
+     * @param timeoutMs The timeout in milliseconds.
+     * @param pTimeTakenSaver pointer to data saver if want the time elapsed before returning result.
+     *
+     * @return bool True if logic produced the expected result within the timeout, false otherwise.
+     */
+    bool TestLogicWithTimeout(hf_utils::WaitableCondition& condition, const std::function<bool()>& logic, bool expected, uint32_t timeoutMs, uint32_t* pTimeTakenSaver=nullptr);
 #endif /* LOGICTESTER_H */
 
 #ifndef HIGH
@@ -829,7 +925,7 @@ constexpr float ConvertPressureUnit(float pressure)
     constexpr float PA_TO_BAR = 0.00001f;
     constexpr float PA_TO_ATM = 0.00000986923f;
     constexpr float PA_TO_MMHG = 0.00750062f;
-    constexpr float PA_TO_INHG = 0.02953f;
+    constexpr float PA_TO_INHG = 0.0002953f;
     constexpr float PA_TO_MBAR = 0.01f;
 
     float inPascals = 0.0;
@@ -878,7 +974,7 @@ constexpr float ConvertFlowUnit(float flow)
 {
     // Conversion constants
     constexpr float SLPM_TO_SLPM = 1.0F;
-    constexpr float SLPM_TO_CMH = 60.0F;
+    constexpr float SLPM_TO_CMH = 0.06F;
     constexpr float SLPM_TO_CFM = 0.0353147F;
     constexpr float SLPM_TO_CIS = 2.11888F;
 
@@ -13,6 +13,9 @@
  * @brief A class template that stores a value of type T and an associated unit of type U.
  *
  * This class provides a way to associate a unit with a variable.
+ *
+ * @see hf_utils::Quantity (Quantity.h) for a compile-time-checked unit that
+ *      adds no storage and no runtime unit checks.
  */
 template <typename T, typename U>
 class VariableWithUnit {
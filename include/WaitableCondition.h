@@ -0,0 +1,130 @@
+/**
+ * @file WaitableCondition.h
+ * @brief Event-driven wait on a caller-defined condition, signalled by producers.
+ *
+ * Replaces "evaluate, sleep, evaluate again" polling. A producer changes some
+ * state and then calls `Notify()`; a consumer blocked in `WaitFor()` /
+ * `WaitUntil()` re-evaluates its predicate immediately and returns as soon as
+ * it holds. Nothing runs while the condition is unchanged.
+ *
+ * \code{.cpp}
+ * hf_utils::WaitableCondition threadStarted;
+ * std::atomic<bool> running{false};
+ *
+ * // worker thread
+ * running.store(true);
+ * threadStarted.Notify();
+ *
+ * // supervisor
+ * bool ok = threadStarted.WaitFor([&] { return running.load(); }, 500U);
+ * \endcode
+ *
+ * `Notify()` with no thread waiting is a fence plus one atomic load; it only
+ * takes the mutex when someone is actually blocked.
+ *
+ * ### Threading and allocation
+ * - No allocation. Built on `std::mutex` / `std::condition_variable`
+ *   (a futex on Linux hosts).
+ * - Any number of producers and waiters. The predicate is evaluated with
+ *   the internal mutex held and must not call back into this object.
+ * - State read by the predicate must be written before `Notify()` is called.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_WAITABLECONDITION_H_
+#define HF_UTILS_GENERAL_WAITABLECONDITION_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace hf_utils {
+
+/**
+ * @brief Condition-variable wait keyed on a predicate supplied by the waiter.
+ */
+class WaitableCondition {
+public:
+    WaitableCondition() noexcept = default;
+
+    WaitableCondition(const WaitableCondition&)            = delete;
+    WaitableCondition& operator=(const WaitableCondition&) = delete;
+
+    /**
+     * @brief Wake every waiter so it re-evaluates its predicate.
+     *
+     * Call after changing the state the waiters' predicates read.
+     */
+    void Notify() noexcept
+    {
+        /// Pairs with the fence in `WaitUntil()`: either we see the waiter or it sees our state
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters_.load(std::memory_order_relaxed) == 0U) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+        }
+        cv_.notify_all();
+    }
+
+    /**
+     * @brief Block until `pred()` is true or `deadline` passes.
+     *
+     * @param pred     Callable returning `bool`.
+     * @param deadline Absolute `steady_clock` deadline.
+     * @return Final value of `pred()`.
+     */
+    template <typename Predicate>
+    bool WaitUntil(Predicate pred, std::chrono::steady_clock::time_point deadline)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        waiters_.fetch_add(1U, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const bool result = cv_.wait_until(lock, deadline, pred);
+        waiters_.fetch_sub(1U, std::memory_order_relaxed);
+        return result;
+    }
+
+    /**
+     * @brief Block until `pred()` is true or `timeoutMs` elapses.
+     *
+     * @param pred      Callable returning `bool`.
+     * @param timeoutMs Timeout in ms; `NO_WAIT` (0) evaluates once.
+     * @return Final value of `pred()`.
+     */
+    template <typename Predicate>
+    bool WaitFor(Predicate pred, uint32_t timeoutMs)
+    {
+        return WaitUntil(pred, std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs));
+    }
+
+    /**
+     * @brief Block until the next `Notify()` or until `timeoutMs` elapses.
+     *
+     * Prefer the predicate overloads; this one can miss a notification that
+     * arrives just before the call.
+     *
+     * @return True if woken by a notification (or spuriously), false on timeout.
+     */
+    bool WaitForNotify(uint32_t timeoutMs)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        waiters_.fetch_add(1U, std::memory_order_relaxed);
+        const bool woken = cv_.wait_for(lock, std::chrono::milliseconds(timeoutMs)) == std::cv_status::no_timeout;
+        waiters_.fetch_sub(1U, std::memory_order_relaxed);
+        return woken;
+    }
+
+private:
+    std::mutex              mutex_;
+    std::condition_variable cv_;
+    std::atomic<uint32_t>   waiters_{0};
+};
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_WAITABLECONDITION_H_ */
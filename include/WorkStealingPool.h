@@ -0,0 +1,367 @@
+/**
+ * @file WorkStealingPool.h
+ * @brief Fixed-size host-side worker pool with per-worker Chase-Lev deques
+ *        and work stealing.
+ *
+ * Work items are plain `uint32_t` indices handed to a single batch handler
+ * (`void (*)(void* ctx, uint32_t index)`), so queues never store closures and
+ * never allocate. A batch is run in three steps:
+ * 1. While the pool is idle, the caller seeds worker deques with `Enqueue()`.
+ * 2. `RunAndWait(handler, ctx)` wakes the workers and blocks until every
+ *    queued (and spawned) item has completed and all workers have parked.
+ * 3. Inside the handler, a job may push follow-up work onto its own worker's
+ *    deque with `Spawn()`.
+ *
+ * Each worker pops from the bottom of its own deque (LIFO) and, when empty,
+ * steals from the top of a sibling's deque (FIFO). A worker that finds
+ * nothing to steal for `kSpinLimit` rounds parks on a condition variable
+ * until `Spawn()` pushes new work or the batch drains, so an uneven batch
+ * does not burn the idle cores.
+ *
+ * ### Threading and allocation
+ * - Worker threads are created once in the constructor and joined in the
+ *   destructor; `std::thread` creation may allocate and may throw.
+ * - No allocation during `Enqueue()` / `RunAndWait()` / `Spawn()`.
+ * - `Enqueue()` and `RunAndWait()` must be called from one controlling
+ *   thread; `Spawn()` only from inside a running handler.
+ * - Requires a hosted toolchain with `<thread>` support. Not intended for
+ *   bare-metal targets.
+ *
+ * @todo Add @copyright line once project copyright wording is finalised.
+ */
+
+#ifndef HF_UTILS_GENERAL_WORKSTEALINGPOOL_H_
+#define HF_UTILS_GENERAL_WORKSTEALINGPOOL_H_
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace hf_utils {
+
+/**
+ * @brief Bounded single-owner / multi-thief Chase-Lev deque of `uint32_t`.
+ *
+ * The owner thread calls `Push()` / `Pop()` at the bottom; any thread may
+ * call `Steal()` at the top. Capacity is fixed; `Push()` fails when full.
+ *
+ * @tparam Capacity Slot count; must be a power of two.
+ */
+template <size_t Capacity>
+class ChaseLevDeque {
+public:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1U)) == 0,
+                  "ChaseLevDeque capacity must be a power of two.");
+
+    ChaseLevDeque() noexcept
+    {
+        for (auto& slot : buffer_) { slot.store(0U, std::memory_order_relaxed); }
+    }
+
+    ChaseLevDeque(const ChaseLevDeque&)            = delete;
+    ChaseLevDeque& operator=(const ChaseLevDeque&) = delete;
+
+    /**
+     * @brief Push an item at the bottom (owner only).
+     * @return `false` if the deque is full.
+     */
+    bool Push(uint32_t item) noexcept
+    {
+        const int64_t b = bottom_.load(std::memory_order_relaxed);
+        const int64_t t = top_.load(std::memory_order_acquire);
+        if (b - t >= static_cast<int64_t>(Capacity)) { return false; }
+        buffer_[static_cast<size_t>(b) & kMask].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(b + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Pop the most recently pushed item (owner only).
+     * @return `false` if the deque was empty or the last item was stolen.
+     */
+    bool Pop(uint32_t& item) noexcept
+    {
+        const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top_.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        item = buffer_[static_cast<size_t>(b) & kMask].load(std::memory_order_relaxed);
+        if (t == b) {
+            // Last item: race the thieves for it.
+            const bool won = top_.compare_exchange_strong(t, t + 1,
+                                                          std::memory_order_seq_cst,
+                                                          std::memory_order_relaxed);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Steal the oldest item (any thread).
+     * @return `false` if the deque was empty or another thread won the race.
+     */
+    bool Steal(uint32_t& item) noexcept
+    {
+        int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t b = bottom_.load(std::memory_order_acquire);
+        if (t >= b) { return false; }
+
+        item = buffer_[static_cast<size_t>(t) & kMask].load(std::memory_order_relaxed);
+        return top_.compare_exchange_strong(t, t + 1,
+                                            std::memory_order_seq_cst,
+                                            std::memory_order_relaxed);
+    }
+
+    /// @return Approximate number of queued items.
+    size_t SizeApprox() const noexcept
+    {
+        const int64_t b = bottom_.load(std::memory_order_relaxed);
+        const int64_t t = top_.load(std::memory_order_relaxed);
+        return (b > t) ? static_cast<size_t>(b - t) : 0U;
+    }
+
+private:
+    static constexpr size_t kMask = Capacity - 1U;
+
+    alignas(64) std::atomic<int64_t> top_{0};
+    alignas(64) std::atomic<int64_t> bottom_{0};
+    std::array<std::atomic<uint32_t>, Capacity> buffer_;
+};
+
+/**
+ * @brief Fixed pool of worker threads sharing work through stealing.
+ *
+ * @tparam MaxWorkers    Upper bound on worker threads (storage is inline).
+ * @tparam QueueCapacity Per-worker deque capacity; power of two.
+ */
+template <size_t MaxWorkers, size_t QueueCapacity = 256>
+class WorkStealingPool {
+public:
+    static_assert(MaxWorkers > 0, "WorkStealingPool requires at least one worker.");
+
+    /// Batch handler invoked once per queued index.
+    using Handler = void (*)(void* ctx, uint32_t index);
+
+    /**
+     * @brief Start the worker threads.
+     *
+     * @param workerCount Requested worker count; clamped to `[1, MaxWorkers]`.
+     *                    `0` selects `std::thread::hardware_concurrency()`.
+     * @throws std::system_error if a thread cannot be started; workers already
+     *         started are stopped and joined first.
+     */
+    explicit WorkStealingPool(size_t workerCount = 0)
+    {
+        if (workerCount == 0) {
+            workerCount = std::thread::hardware_concurrency();
+        }
+        if (workerCount == 0)         { workerCount = 1; }
+        if (workerCount > MaxWorkers) { workerCount = MaxWorkers; }
+        workerCount_ = workerCount;
+
+        try {
+            for (size_t i = 0; i < workerCount_; ++i) {
+                threads_[i] = std::thread(&WorkStealingPool::WorkerLoop, this, i);
+            }
+        } catch (...) {
+            /// The destructor will not run; joinable threads left behind would call std::terminate
+            StopAndJoin();
+            throw;
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool&)            = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * @brief Stop and join all workers.
+     */
+    ~WorkStealingPool() { StopAndJoin(); }
+
+    /// @return Number of running worker threads.
+    size_t WorkerCount() const noexcept { return workerCount_; }
+
+    /**
+     * @brief Seed a worker's deque before `RunAndWait()`.
+     *
+     * Only valid while the pool is idle (no batch running).
+     *
+     * @param worker Target worker; wrapped modulo `WorkerCount()`.
+     * @param index  Work item passed to the batch handler.
+     * @return `false` if that worker's deque is full.
+     */
+    bool Enqueue(size_t worker, uint32_t index) noexcept
+    {
+        if (!queues_[worker % workerCount_].Push(index)) { return false; }
+        pending_.fetch_add(1U, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Push follow-up work from inside a running handler.
+     *
+     * The item lands on the calling worker's own deque. If the deque is full
+     * (or the caller is not a worker of this pool) the item runs inline.
+     *
+     * @param index Work item passed to the batch handler.
+     */
+    void Spawn(uint32_t index) noexcept
+    {
+        if (tlsPool_ == this) {
+            pending_.fetch_add(1U, std::memory_order_relaxed);
+            if (queues_[tlsWorker_].Push(index)) {
+                WakeIdle(false);
+                return;
+            }
+            pending_.fetch_sub(1U, std::memory_order_relaxed);
+        }
+        handler_(ctx_, index);
+    }
+
+    /**
+     * @brief Run every queued item on the workers and block until done.
+     *
+     * @param handler Function invoked once per item.
+     * @param ctx     Opaque pointer forwarded to `handler`.
+     */
+    void RunAndWait(Handler handler, void* ctx) noexcept
+    {
+        if (pending_.load(std::memory_order_relaxed) == 0U) { return; }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        handler_ = handler;
+        ctx_     = ctx;
+        active_  = workerCount_;
+        ++generation_;
+        wakeCv_.notify_all();
+        doneCv_.wait(lock, [this] { return active_ == 0U; });
+    }
+
+private:
+    /// Wake every worker with `stop_` set and join the ones that were started.
+    void StopAndJoin() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wakeCv_.notify_all();
+        for (size_t i = 0; i < workerCount_; ++i) {
+            if (threads_[i].joinable()) { threads_[i].join(); }
+        }
+    }
+
+    void WorkerLoop(size_t self) noexcept
+    {
+        tlsPool_   = this;
+        tlsWorker_ = self;
+        uint64_t seen = 0;
+
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wakeCv_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                if (stop_) { return; }
+                seen = generation_;
+            }
+
+            unsigned failedSteals = 0;
+            while (pending_.load(std::memory_order_acquire) != 0U) {
+                uint32_t index = 0;
+                if (queues_[self].Pop(index) || TrySteal(self, index)) {
+                    failedSteals = 0;
+                    handler_(ctx_, index);
+                    if (pending_.fetch_sub(1U, std::memory_order_acq_rel) == 1U) { WakeIdle(true); }
+                } else if (++failedSteals < kSpinLimit) {
+                    std::this_thread::yield();
+                } else {
+                    failedSteals = 0;
+                    Park();
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--active_ == 0U) { doneCv_.notify_all(); }
+        }
+    }
+
+    /// Sleep until some deque has work or the batch has drained.
+    void Park() noexcept
+    {
+        idlers_.fetch_add(1U, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        {
+            std::unique_lock<std::mutex> lock(idleMutex_);
+            idleCv_.wait(lock, [this] { return pending_.load(std::memory_order_seq_cst) == 0U || HasQueuedWork(); });
+        }
+        idlers_.fetch_sub(1U, std::memory_order_relaxed);
+    }
+
+    /// Wake parked workers after new work was pushed (one) or the batch drained (all).
+    void WakeIdle(bool all) noexcept
+    {
+        // Pairs with the seq_cst increment in Park(): either the parker sees the
+        // new state in its predicate, or we see it registered and notify.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (idlers_.load(std::memory_order_relaxed) == 0U) { return; }
+        { std::lock_guard<std::mutex> lock(idleMutex_); }
+        if (all) { idleCv_.notify_all(); } else { idleCv_.notify_one(); }
+    }
+
+    bool HasQueuedWork() const noexcept
+    {
+        for (size_t i = 0; i < workerCount_; ++i) {
+            if (queues_[i].SizeApprox() != 0U) { return true; }
+        }
+        return false;
+    }
+
+    bool TrySteal(size_t self, uint32_t& index) noexcept
+    {
+        for (size_t k = 1; k < workerCount_; ++k) {
+            if (queues_[(self + k) % workerCount_].Steal(index)) { return true; }
+        }
+        return false;
+    }
+
+    std::array<ChaseLevDeque<QueueCapacity>, MaxWorkers> queues_;
+    std::array<std::thread, MaxWorkers> threads_;
+    size_t workerCount_{0};
+
+    /// Failed pop/steal rounds (each followed by a yield) before an idle worker parks.
+    static constexpr unsigned kSpinLimit = 64;
+
+    std::atomic<uint32_t> pending_{0};
+    std::atomic<uint32_t> idlers_{0};
+    Handler handler_{nullptr};
+    void*   ctx_{nullptr};
+
+    std::mutex              mutex_;
+    std::condition_variable wakeCv_;
+    std::condition_variable doneCv_;
+    std::mutex              idleMutex_;
+    std::condition_variable idleCv_;
+    uint64_t generation_{0};
+    size_t   active_{0};
+    bool     stop_{false};
+
+    static inline thread_local const WorkStealingPool* tlsPool_   = nullptr;
+    static inline thread_local size_t                  tlsWorker_ = 0;
+};
+
+} // namespace hf_utils
+
+#endif /* HF_UTILS_GENERAL_WORKSTEALINGPOOL_H_ */
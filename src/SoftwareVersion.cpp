@@ -4,9 +4,9 @@
  * @todo Add @copyright line once project copyright wording is finalised.
  */
 
-#include <cstdio>
 #include <cstring>
 
+#include "NumericText.h"
 #include "SoftwareVersion.h"
 
 //==============================================================//
@@ -58,7 +58,16 @@ SoftwareVersion::SoftwareVersion(uint8_t majorArg, uint8_t minorArg, uint32_t bu
     build(buildArg),
     text()
 {
-    snprintf(text, sizeof(text), "v%u.%u.%lu", major, minor, build);
+    /// Locale-free formatting; "v255.255.4294967295" plus terminator always fits MaxStringLength
+    char* const last = text + sizeof(text) - 1U;
+    char* p = text;
+    *p++ = 'v';
+    p = hf_utils::FormatInteger(p, last, major).ptr;
+    *p++ = '.';
+    p = hf_utils::FormatInteger(p, last, minor).ptr;
+    *p++ = '.';
+    p = hf_utils::FormatInteger(p, last, build).ptr;
+    *p = '\0';
 }
 
 /**
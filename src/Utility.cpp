@@ -8,14 +8,24 @@
  */
 
 #include "Utility.h"
-#include "OsUtility.h"
+#include "StringViewUtils.h"
+#include "WaitableCondition.h"
 #include "platform_compat.h"
 
 #include <string>
 #include <algorithm> // For std::transform
 #include <cctype>    // For ::tolower, ::toupper
+#include <chrono>
+#include <cstddef>
+#include <thread>    // For std::this_thread::sleep_for
 #include <vector>
 
+#if defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 /**
  * @brief Converts a string to lowercase.
  *
@@ -76,16 +86,8 @@ std::string StringTrim(const std::string& str) {
  */
 std::vector<std::string> StringSplit(const std::string& str, char delimiter) {
     std::vector<std::string> tokens;
-    std::size_t start = 0;
-    const std::size_t n = str.size();
-    while (start <= n) {
-        const std::size_t end = str.find(delimiter, start);
-        if (end == std::string::npos) {
-            tokens.emplace_back(str, start, n - start);
-            break;
-        }
-        tokens.emplace_back(str, start, end - start);
-        start = end + 1U;
+    for (std::string_view token : hf_utils::StringSplitView(str, delimiter)) {
+        tokens.emplace_back(token);
     }
     return tokens;
 }
@@ -131,7 +133,7 @@ bool ConvertPressureUnit(float pressure, pressure_unit_id_t fromUnit, float &out
 	const float PA_TO_BAR = 0.00001f;
 	const float PA_TO_ATM = 0.00000986923f;
 	const float PA_TO_MMHG = 0.00750062f;
-	const float PA_TO_INHG = 0.02953f;
+	const float PA_TO_INHG = 0.0002953f;
 	const float PA_TO_MBAR = 0.01f;
 
 	float inPascals = 0.0;
@@ -199,7 +201,7 @@ bool ConvertFlowUnit(float flow, flow_unit_id_t fromUnit, float &outputValue, fl
 {
     /// Conversion constants
     const float SLPM_TO_SLPM = 1.0F;
-    const float SLPM_TO_CMH = 60.0F;
+    const float SLPM_TO_CMH = 0.06F;
     const float SLPM_TO_CFM = 0.0353147F;
     const float SLPM_TO_CIS = 2.11888F;
 
@@ -303,6 +305,131 @@ bool ConvertTemperatureUnit(float temp, temp_unit_id_t fromUnit, float &outputVa
 }
 
 
+//==============================================================//
+/// BATCH CONVERSION
+//==============================================================//
+
+namespace {
+
+/// y = x * scale + offset; every from->to unit pair folds into one of these
+struct AffineConversion {
+    double scale;
+    double offset;
+};
+
+/// Pressure units per Pascal, indexed by pressure_unit_id_t (same constants as ConvertPressureUnit)
+constexpr double kPressurePerPascal[] = {
+    0.000145038, 1.0, 0.00001, 0.00000986923, 0.00750062, 0.02953, 0.01,
+};
+
+/// Flow units per SLPM, indexed by flow_unit_id_t (same constants as ConvertFlowUnit)
+constexpr double kFlowPerSlpm[] = {
+    1.0, 60.0, 0.0353147, 2.11888,
+};
+
+/// Seconds per unit, indexed by TimeUnit (same constants as ConvertTime)
+constexpr double kSecondsPerTimeUnit[] = {
+    1e-9, 1e-6, 1e-3, 1.0, 60.0, 3600.0, 86400.0, 31536000.0,
+};
+
+/// Celsius = x * scale + offset, indexed by temp_unit_id_t
+constexpr AffineConversion kTemperatureToCelsius[] = {
+    {1.0, 0.0},
+    {100.0 / 180.0, -32.0 * 100.0 / 180.0},
+    {1.0, -273.15},
+};
+
+template <typename Unit, size_t Count>
+bool LinearConversion(const double (&perBase)[Count], Unit from, Unit to, AffineConversion& conversion)
+{
+    const size_t f = static_cast<size_t>(from);
+    const size_t t = static_cast<size_t>(to);
+    if (f >= Count || t >= Count) {
+        return false;
+    }
+    conversion = {perBase[t] / perBase[f], 0.0};
+    return true;
+}
+
+/**
+ * @brief out[i] = in[i] * scale + offset, four lanes at a time where SIMD is available.
+ *
+ * `in` and `out` may be the same array (in-place conversion).
+ */
+void ApplyAffine(const float* in, float* out, size_t count, const AffineConversion& conversion)
+{
+    const float scale = static_cast<float>(conversion.scale);
+    const float offset = static_cast<float>(conversion.offset);
+    size_t i = 0;
+
+#if defined(__SSE__) || defined(_M_X64)
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 voffset = _mm_set1_ps(offset);
+    for (; i + 4U <= count; i += 4U) {
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(in + i), vscale), voffset));
+    }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    const float32x4_t voffset = vdupq_n_f32(offset);
+    for (; i + 4U <= count; i += 4U) {
+        vst1q_f32(out + i, vmlaq_n_f32(voffset, vld1q_f32(in + i), scale));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        out[i] = in[i] * scale + offset;
+    }
+}
+
+} // namespace
+
+bool ConvertPressureUnits(const float* in, float* out, size_t count, pressure_unit_id_t fromUnit, pressure_unit_id_t toUnit)
+{
+    AffineConversion conversion{};
+    if (!LinearConversion(kPressurePerPascal, fromUnit, toUnit, conversion)) {
+        return false;
+    }
+    ApplyAffine(in, out, count, conversion);
+    return true;
+}
+
+bool ConvertFlowUnits(const float* in, float* out, size_t count, flow_unit_id_t fromUnit, flow_unit_id_t toUnit)
+{
+    AffineConversion conversion{};
+    if (!LinearConversion(kFlowPerSlpm, fromUnit, toUnit, conversion)) {
+        return false;
+    }
+    ApplyAffine(in, out, count, conversion);
+    return true;
+}
+
+bool ConvertTimes(const float* in, float* out, size_t count, TimeUnit inputUnit, TimeUnit outputUnit)
+{
+    AffineConversion conversion{};
+    /// Table holds seconds per unit, i.e. the inverse of "units per base"
+    if (!LinearConversion(kSecondsPerTimeUnit, outputUnit, inputUnit, conversion)) {
+        return false;
+    }
+    ApplyAffine(in, out, count, conversion);
+    return true;
+}
+
+bool ConvertTemperatureUnits(const float* in, float* out, size_t count, temp_unit_id_t fromUnit, temp_unit_id_t toUnit)
+{
+    const size_t f = static_cast<size_t>(fromUnit);
+    const size_t t = static_cast<size_t>(toUnit);
+    constexpr size_t unitCount = sizeof(kTemperatureToCelsius) / sizeof(kTemperatureToCelsius[0]);
+    if (f >= unitCount || t >= unitCount) {
+        return false;
+    }
+
+    /// Compose from->Celsius with the inverse of to->Celsius
+    const AffineConversion& toC = kTemperatureToCelsius[f];
+    const AffineConversion& fromC = kTemperatureToCelsius[t];
+    const AffineConversion conversion{toC.scale / fromC.scale, (toC.offset - fromC.offset) / fromC.scale};
+    ApplyAffine(in, out, count, conversion);
+    return true;
+}
+
 bool TestLogicWithTimeout(const std::function<bool()>& logic, bool expected, uint32_t timeoutMs, uint32_t timeBetweenChecksMs, uint32_t *pTimeTakenSav) {
     uint32_t startTime = GetElapsedTimeMsec();
 
@@ -327,7 +454,7 @@ bool TestLogicWithTimeout(const std::function<bool()>& logic, bool expected, uin
             // tasks (e.g. SystemOrchestrator prio 5 waiting here pins Console RX
             // prio 4 on PRO_CPU) so StartThreadAndWaitToVerify never observes
             // IsThreadRunning() == true.
-            os_delay_msec(static_cast<uint16_t>(CONSTRAIN(timeBetweenChecksMs, 1, timeoutMs)));
+            std::this_thread::sleep_for(std::chrono::milliseconds(CONSTRAIN(timeBetweenChecksMs, 1u, timeoutMs)));
         }
     }
 
@@ -337,6 +464,17 @@ bool TestLogicWithTimeout(const std::function<bool()>& logic, bool expected, uin
     return status;
 }
 
+bool TestLogicWithTimeout(hf_utils::WaitableCondition& condition, const std::function<bool()>& logic, bool expected, uint32_t timeoutMs, uint32_t *pTimeTakenSav) {
+    uint32_t startTime = GetElapsedTimeMsec();
+
+    /// Woken by condition.Notify() instead of polling; NO_WAIT evaluates once
+    bool status = condition.WaitFor([&]() { return logic() == expected; }, timeoutMs);
+
+    if(pTimeTakenSav) {*pTimeTakenSav = (GetElapsedTimeMsec()-startTime);} /// Store time taken (calculated for start time to end)
+
+    return status;
+}
+
 int32_t TwosCompliment( uint32_t value, uint8_t msb ) noexcept
 {
     if( msb > 0 )
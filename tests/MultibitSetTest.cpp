@@ -0,0 +1,262 @@
+/**
+ * @file MultibitSetTest.cpp
+ * @brief Bit-identical behaviour of the word-backed MultibitSet against the
+ *        original std::bitset implementation.
+ *
+ * `LegacyMultibitSet` below is the previous `std::bitset`-based MultibitSet,
+ * kept verbatim apart from the class name and a compiler-bug workaround on
+ * `get()`. For every BitsPerEntry 1..8 and a
+ * spread of entry counts (including counts whose entries straddle 64-bit
+ * words and leave a partial last word), random sequences of set / clear /
+ * fill / erase / copy must leave `get()` identical on every index, including
+ * out-of-range indices and values wider than the field. The SWAR queries
+ * (`any`, `count`, `matches`) are checked against a scan of the legacy set.
+ *
+ * Build and run (exits non-zero on failure):
+ * @code
+ * g++ -std=c++17 -O2 -Iinclude tests/MultibitSetTest.cpp -o multibitset_test && ./multibitset_test
+ * @endcode
+ */
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+
+#include "MultibitSet.h"
+
+namespace {
+
+int g_failures = 0;
+
+#define CHECK(condition, ...)                                                   \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            if (++g_failures <= 20) {                                           \
+                std::printf("%s:%d: CHECK(%s) failed: ", __FILE__, __LINE__, #condition); \
+                std::printf(__VA_ARGS__);                                       \
+                std::printf("\n");                                              \
+            }                                                                   \
+        }                                                                       \
+    } while (0)
+
+//==============================================================//
+/// ORIGINAL IMPLEMENTATION
+//==============================================================//
+
+// GCC before 12.4 / 13.3 (PR 113907) folds identical copies of get() across EntryCount and keeps
+// one copy's argument ranges, turning the comparison loops below into endless loops at -O2.
+#if defined(__GNUC__) && !defined(__clang__)
+#define LEGACY_NO_ICF __attribute__((no_icf))
+#else
+#define LEGACY_NO_ICF
+#endif
+
+template < uint8_t BitsPerEntry, uint16_t EntryCount> class LegacyMultibitSet
+{
+
+public:
+	LegacyMultibitSet( uint8_t initialValueArg = 0 ) noexcept :
+		initialValue(initialValueArg),
+		bitset()
+	{
+	   erase();
+	}
+
+	uint16_t size() const noexcept
+	{
+		return EntryCount;
+	}
+
+	void erase() noexcept
+	{
+		for( uint16_t valueIndex = 0; valueIndex < size(); ++valueIndex )
+		{
+			clear( valueIndex);
+		}
+	}
+
+    void set( uint16_t valueIndex, uint8_t value ) noexcept
+    {
+    	if( valueIndex < EntryCount )
+    	{
+
+    		volatile const uint16_t firstBit = valueIndex * BitsPerEntry; // BJR 5: 9
+    		volatile const uint16_t lastBit = firstBit + BitsPerEntry - 1;
+
+			uint8_t bitMask = 1 << (BitsPerEntry-1);
+			for( uint16_t bitsetIndex = firstBit; bitsetIndex <= lastBit; ++bitsetIndex )
+			{
+				bitset[bitsetIndex] = value & bitMask;     // Populate the bit
+				bitMask >>= 1;
+			}
+    	}
+    }
+
+    void clear( uint16_t valueIndex) noexcept
+    {
+    	set(valueIndex, initialValue);
+    }
+
+     LEGACY_NO_ICF uint8_t get( uint16_t valueIndex) const noexcept
+     {
+		if( valueIndex < EntryCount )
+		{
+			uint8_t value = 0;
+			const uint16_t firstBit = valueIndex * BitsPerEntry; // BJR 5: 9
+			const uint16_t lastBit = firstBit + BitsPerEntry -1;
+
+			for( uint16_t bitsetIndex = firstBit; bitsetIndex <= lastBit; ++bitsetIndex )
+			{
+				if( bitset[bitsetIndex] )    // Populate the bit
+				{
+					value += 1;
+				}
+				if( bitsetIndex < lastBit )
+				{
+					value <<= 1;
+				}
+			}
+			return value;
+		}
+		else
+		{
+			return initialValue;
+		}
+     }
+
+private:
+
+     uint8_t initialValue;
+	 std::bitset<BitsPerEntry * EntryCount> bitset;
+};
+
+//==============================================================//
+/// COMPARISON
+//==============================================================//
+
+template <uint8_t Bits, uint16_t Count>
+bool SameContents(const MultibitSet<Bits, Count>& current, const LegacyMultibitSet<Bits, Count>& legacy,
+                  const char* step)
+{
+    // Includes a few out-of-range indices, which return the initial value.
+    for (uint32_t i = 0; i < uint32_t(Count) + 3U; ++i) {
+        const uint16_t index = uint16_t(i);
+        if (current.get(index) != legacy.get(index)) {
+            CHECK(false, "Bits=%u Count=%u after %s: get(%u) = %u, legacy %u", unsigned(Bits), unsigned(Count), step,
+                  unsigned(index), unsigned(current.get(index)), unsigned(legacy.get(index)));
+            return false;
+        }
+    }
+    CHECK(current.get(0xFFFFU) == legacy.get(0xFFFFU), "Bits=%u Count=%u: get(0xFFFF)", unsigned(Bits),
+          unsigned(Count));
+    return true;
+}
+
+template <uint8_t Bits, uint16_t Count>
+void CheckQueries(const MultibitSet<Bits, Count>& current, const LegacyMultibitSet<Bits, Count>& legacy)
+{
+    // Scan the legacy set once rather than once per queried value.
+    std::array<uint8_t, Count> fields{};
+    for (uint16_t i = 0; i < Count; ++i) { fields[i] = legacy.get(i); }
+
+    for (unsigned value = 0; value < 256U; value += (value < 16U) ? 1U : 37U) {
+        const uint8_t field = uint8_t(value & ((1U << Bits) - 1U));
+        uint16_t expected = 0;
+        for (uint8_t f : fields) { expected += (f == field) ? 1U : 0U; }
+
+        CHECK(current.count(uint8_t(value)) == expected, "Bits=%u Count=%u: count(%u) = %u, expected %u",
+              unsigned(Bits), unsigned(Count), value, unsigned(current.count(uint8_t(value))), unsigned(expected));
+        CHECK(current.any(uint8_t(value)) == (expected != 0U), "Bits=%u Count=%u: any(%u)", unsigned(Bits),
+              unsigned(Count), value);
+
+        uint16_t previous = 0;
+        uint16_t visited = 0;
+        bool ordered = true;
+        for (uint16_t index : current.matches(uint8_t(value))) {
+            ordered = ordered && (visited == 0U || index > previous) && index < Count && fields[index] == field;
+            previous = index;
+            ++visited;
+        }
+        CHECK(ordered && visited == expected, "Bits=%u Count=%u: matches(%u) visited %u of %u", unsigned(Bits),
+              unsigned(Count), value, unsigned(visited), unsigned(expected));
+    }
+}
+
+template <uint8_t Bits, uint16_t Count>
+void RunCase(std::mt19937& rng)
+{
+    for (int round = 0; round < 8; ++round) {
+        const uint8_t initial = uint8_t(rng());
+        MultibitSet<Bits, Count> current(initial);
+        LegacyMultibitSet<Bits, Count> legacy(initial);
+        if (!SameContents(current, legacy, "construction")) { return; }
+
+        for (int op = 0; op < 4 * Count + 64; ++op) {
+            const uint16_t index = uint16_t(rng() % (Count + 4U));   // some out of range
+            const uint8_t value = uint8_t(rng());                    // upper bits must be ignored
+            const unsigned kind = rng() % 100U;
+            const char* step = "set";
+            if (kind < 80U) {
+                current.set(index, value);
+                legacy.set(index, value);
+            } else if (kind < 95U) {
+                current.clear(index);
+                legacy.clear(index);
+                step = "clear";
+            } else if (kind < 98U) {
+                current.fill(value);
+                for (uint16_t i = 0; i < Count; ++i) { legacy.set(i, value); }
+                step = "fill";
+            } else {
+                current.erase();
+                legacy.erase();
+                step = "erase";
+            }
+            if (!SameContents(current, legacy, step)) { return; }
+        }
+
+        const MultibitSet<Bits, Count> copy(current);
+        MultibitSet<Bits, Count> assigned;
+        assigned = current;
+        if (!SameContents(copy, legacy, "copy") || !SameContents(assigned, legacy, "assignment")) { return; }
+        CheckQueries(current, legacy);
+    }
+}
+
+template <uint8_t Bits>
+void RunBits(std::mt19937& rng)
+{
+    // 1 entry, one word exactly or not, several words, straddling fields, large sets.
+    RunCase<Bits, 1>(rng);
+    RunCase<Bits, 7>(rng);
+    RunCase<Bits, 21>(rng);
+    RunCase<Bits, 64>(rng);
+    RunCase<Bits, 65>(rng);
+    RunCase<Bits, 100>(rng);
+    RunCase<Bits, 333>(rng);
+    RunCase<Bits, 1024>(rng);
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937 rng(2024);
+    RunBits<1>(rng);
+    RunBits<2>(rng);
+    RunBits<3>(rng);
+    RunBits<4>(rng);
+    RunBits<5>(rng);
+    RunBits<6>(rng);
+    RunBits<7>(rng);
+    RunBits<8>(rng);
+
+    if (g_failures != 0) {
+        std::printf("MultibitSetTest: %d failure(s)\n", g_failures);
+        return 1;
+    }
+    std::printf("MultibitSetTest: all passed\n");
+    return 0;
+}
@@ -0,0 +1,289 @@
+/**
+ * @file NumericTextTest.cpp
+ * @brief Round-trip and exactness tests for NumericText.h.
+ *
+ * - Every finite `double` formatted with 17 significant digits (and every
+ *   `float` with 9) parses back to the same bits; checked on random bit
+ *   patterns plus the subnormal, min-normal and max boundaries.
+ * - Formatting with 1..17 digits matches the correctly rounded digits that
+ *   `printf("%.*e")` produces.
+ * - Parsing long and extreme-exponent inputs matches `strtod` (both are
+ *   correctly rounded, ties to even), and `float` parsing matches `strtof`
+ *   on inputs at and next to halfway points between floats, where rounding
+ *   through `double` first would go wrong.
+ * - `ParseInteger` rejects bases outside [2, 36].
+ *
+ * Build and run (exits non-zero on failure):
+ * @code
+ * g++ -std=c++17 -O2 -Iinclude tests/NumericTextTest.cpp -o numeric_text_test && ./numeric_text_test
+ * @endcode
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+
+#include "NumericText.h"
+
+using hf_utils::NumericError;
+
+namespace {
+
+int g_failures = 0;
+
+#define CHECK(condition, ...)                                                   \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            if (++g_failures <= 20) {                                           \
+                std::printf("%s:%d: CHECK(%s) failed: ", __FILE__, __LINE__, #condition); \
+                std::printf(__VA_ARGS__);                                       \
+                std::printf("\n");                                              \
+            }                                                                   \
+        }                                                                       \
+    } while (0)
+
+template <typename T>
+bool SameBits(T a, T b)
+{
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+template <typename T>
+std::string Format(T value, int digits)
+{
+    char buffer[64];
+    const hf_utils::ToCharsResult r = hf_utils::FormatFloat(buffer, buffer + sizeof(buffer), value, digits);
+    return std::string(buffer, r.ptr);
+}
+
+void CheckDoubleRoundTrip(double value)
+{
+    const std::string text = Format(value, 17);
+    double back = 0.0;
+    const hf_utils::FromCharsResult r = hf_utils::ParseFloat(text.data(), text.data() + text.size(), back);
+    CHECK(r.error == NumericError::None && r.ptr == text.data() + text.size() && SameBits(back, value),
+          "%.17g formatted as \"%s\" parsed back as %.17g (error %d)", value, text.c_str(), back, int(r.error));
+}
+
+void CheckFloatRoundTrip(float value)
+{
+    const std::string text = Format(value, 9);
+    float back = 0.0f;
+    const hf_utils::FromCharsResult r = hf_utils::ParseFloat(text.data(), text.data() + text.size(), back);
+    CHECK(r.error == NumericError::None && SameBits(back, value),
+          "%.9g formatted as \"%s\" parsed back as %.9g (error %d)", double(value), text.c_str(), double(back),
+          int(r.error));
+}
+
+/// Significant digits (trailing zeros stripped) and decimal exponent of a number in any layout.
+void Normalise(const std::string& text, std::string& digits, int& exp10)
+{
+    digits.clear();
+    exp10 = 0;
+    int integerDigits = 0;
+    int leadingFractionZeros = 0;
+    bool fraction = false;
+    size_t i = (text[0] == '-') ? 1U : 0U;
+    for (; i < text.size() && text[i] != 'e'; ++i) {
+        if (text[i] == '.') { fraction = true; continue; }
+        if (digits.empty() && text[i] == '0') {
+            leadingFractionZeros += fraction ? 1 : 0;
+            continue;
+        }
+        integerDigits += fraction ? 0 : 1;
+        digits += text[i];
+    }
+    exp10 = (integerDigits > 0) ? integerDigits - 1 : -(leadingFractionZeros + 1);
+    if (i < text.size()) { exp10 += std::atoi(text.c_str() + i + 1); }
+    while (digits.size() > 1U && digits.back() == '0') { digits.pop_back(); }
+}
+
+void TestBoundaries()
+{
+    const double doubles[] = {
+        5e-324,                                  // smallest subnormal
+        1e-323, 2.2250738585072009e-308,         // subnormals
+        2.2250738585072014e-308,                 // smallest normal
+        1e-300, 1e-22, 1e-5, 0.1, 1.0 / 3.0, 1.0, 9007199254740993.0, 1e22, 1e23,
+        9.9999999999999992e+22, 1.7976931348623157e308,
+    };
+    for (double v : doubles) {
+        CheckDoubleRoundTrip(v);
+        CheckDoubleRoundTrip(-v);
+    }
+    CheckDoubleRoundTrip(std::numeric_limits<double>::denorm_min());
+    CheckDoubleRoundTrip(std::numeric_limits<double>::min());
+    CheckDoubleRoundTrip(std::numeric_limits<double>::max());
+    CheckDoubleRoundTrip(std::nextafter(std::numeric_limits<double>::min(), 0.0));
+
+    const float floats[] = {
+        std::numeric_limits<float>::denorm_min(), std::numeric_limits<float>::min(),
+        std::numeric_limits<float>::max(), 0.1f, 1.0f / 3.0f, 16777217.0f,
+    };
+    for (float v : floats) {
+        CheckFloatRoundTrip(v);
+        CheckFloatRoundTrip(-v);
+    }
+
+    CHECK(Format(5e-324, 17) == "4.9406564584124654e-324", "got %s", Format(5e-324, 17).c_str());
+    CHECK(Format(1e-300, 17) == "1e-300", "got %s", Format(1e-300, 17).c_str());
+    CHECK(Format(2.2250738585072014e-308, 17) == "2.2250738585072014e-308", "got %s",
+          Format(2.2250738585072014e-308, 17).c_str());
+}
+
+void TestRandomRoundTrip()
+{
+    std::mt19937_64 rng(12345);
+    for (int i = 0; i < 200000; ++i) {
+        const uint64_t bits = rng();
+        double v = 0.0;
+        std::memcpy(&v, &bits, sizeof(v));
+        if (std::isfinite(v)) { CheckDoubleRoundTrip(v); }
+    }
+    for (int i = 0; i < 200000; ++i) {
+        const uint32_t bits = static_cast<uint32_t>(rng());
+        float v = 0.0f;
+        std::memcpy(&v, &bits, sizeof(v));
+        if (std::isfinite(v)) { CheckFloatRoundTrip(v); }
+    }
+}
+
+void TestCorrectlyRoundedDigits()
+{
+    std::mt19937_64 rng(777);
+    for (int i = 0; i < 100000; ++i) {
+        const uint64_t bits = rng();
+        double v = 0.0;
+        std::memcpy(&v, &bits, sizeof(v));
+        if (!std::isfinite(v) || v == 0.0) { continue; }
+        const int digits = 1 + int(rng() % 17U);
+        char reference[64];
+        std::snprintf(reference, sizeof(reference), "%.*e", digits - 1, v);
+        std::string ours, theirs;
+        int oursExp = 0, theirsExp = 0;
+        Normalise(Format(v, digits), ours, oursExp);
+        Normalise(reference, theirs, theirsExp);
+        CHECK(ours == theirs && oursExp == theirsExp, "%d digits of %.17g: \"%s\", expected %s", digits, v,
+              Format(v, digits).c_str(), reference);
+    }
+}
+
+void TestParseMatchesStrtod()
+{
+    const char* hard[] = {
+        "2.4703282292062328e-324",                                 // just above the first halfway point
+        "9007199254740993",                                        // tie, rounds to even
+        "9007199254740993.0000000000000000000001",                 // just above the tie
+        "1.7976931348623158e308",                                  // rounds down to max
+        "7.4109846876186981626485318930233205854758970e-324",
+        "123456789012345678901234567890",
+        "0.000000000000000000000000000000000001",
+    };
+    for (const char* text : hard) {
+        double ours = 0.0;
+        const hf_utils::FromCharsResult r = hf_utils::ParseFloat(text, text + std::strlen(text), ours);
+        const double reference = std::strtod(text, nullptr);
+        CHECK(r.error == NumericError::None && SameBits(ours, reference), "\"%s\" -> %.17g, expected %.17g", text,
+              ours, reference);
+    }
+
+    double unchanged = 1.0;
+    const char* tooSmall = "2.4703282292062327e-324";
+    CHECK(hf_utils::ParseFloat(tooSmall, tooSmall + std::strlen(tooSmall), unchanged).error == NumericError::OutOfRange
+          && unchanged == 1.0, "underflow not reported");
+    const char* tooLarge = "1.7976931348623159e308";
+    CHECK(hf_utils::ParseFloat(tooLarge, tooLarge + std::strlen(tooLarge), unchanged).error == NumericError::OutOfRange
+          && unchanged == 1.0, "overflow not reported");
+
+    std::mt19937_64 rng(99);
+    for (int i = 0; i < 50000; ++i) {
+        std::string text;
+        const int digitCount = (i % 16 == 0) ? 700 + int(rng() % 200U) : 1 + int(rng() % 40U);
+        for (int k = 0; k < digitCount; ++k) { text += char('0' + rng() % 10U); }
+        if (rng() % 2U) { text.insert(rng() % text.size(), "."); }
+        text += "e" + std::to_string(int(rng() % 700U) - 350);
+
+        const double reference = std::strtod(text.c_str(), nullptr);
+        if (reference == 0.0 || std::isinf(reference)) { continue; }
+        double ours = 0.0;
+        const hf_utils::FromCharsResult r = hf_utils::ParseFloat(text.data(), text.data() + text.size(), ours);
+        CHECK(r.error == NumericError::None && SameBits(ours, reference), "\"%.60s...\" -> %.17g, expected %.17g",
+              text.c_str(), ours, reference);
+    }
+}
+
+void TestParseFloatMatchesStrtof()
+{
+    const char* hard[] = {
+        "1.00000005960464477550",           // just above a halfway point; via double it lands on the tie
+        "16777217.000000000001",            // likewise, above 2^24 + 1
+        "1.00000017881393432617187499",     // just below a halfway point
+        "7.038531e-26",
+        "16777217",                         // exact tie, rounds to even
+        "7.0064924e-46",                    // rounds up to the smallest subnormal
+        "1.17549435e-38",                   // smallest normal
+        "3.4028235e38",                     // max
+    };
+    for (const char* text : hard) {
+        float ours = 0.0f;
+        const hf_utils::FromCharsResult r = hf_utils::ParseFloat(text, text + std::strlen(text), ours);
+        const float reference = std::strtof(text, nullptr);
+        CHECK(r.error == NumericError::None && SameBits(ours, reference), "\"%s\" -> %.9g, expected %.9g", text,
+              double(ours), double(reference));
+    }
+
+    // Midpoints of adjacent floats (exact in double), printed exactly or cut to a few digits either side.
+    std::mt19937_64 rng(4242);
+    for (int i = 0; i < 200000; ++i) {
+        const uint32_t bits = static_cast<uint32_t>(rng()) & 0x7F7FFFFFU;   // finite, below the top binade
+        float low = 0.0f;
+        std::memcpy(&low, &bits, sizeof(low));
+        const double mid = (double(low) + double(std::nextafter(low, HUGE_VALF))) / 2.0;
+        char text[160];
+        std::snprintf(text, sizeof(text), "%.*e", (rng() % 2U) ? 120 : 8 + int(rng() % 20U), mid);
+        const float reference = std::strtof(text, nullptr);
+        if (reference == 0.0f || std::isinf(reference)) { continue; }
+        float ours = 0.0f;
+        const hf_utils::FromCharsResult r = hf_utils::ParseFloat(text, text + std::strlen(text), ours);
+        CHECK(r.error == NumericError::None && SameBits(ours, reference), "\"%.40s...\" -> %.9g, expected %.9g",
+              text, double(ours), double(reference));
+    }
+}
+
+void TestIntegerBase()
+{
+    const char text[] = "zz";
+    int value = 7;
+    CHECK(hf_utils::ParseInteger(text, text + 2, value, 40).error == NumericError::InvalidArgument && value == 7,
+          "base 40 accepted");
+    CHECK(hf_utils::ParseInteger(text, text + 2, value, 1).error == NumericError::InvalidArgument, "base 1 accepted");
+    uint8_t narrow = 0;
+    CHECK(hf_utils::ParseInteger(text, text + 2, narrow, 256 + 36).error == NumericError::InvalidArgument,
+          "base truncated to the value type");
+    CHECK(hf_utils::ParseInteger(text, text + 2, value, 36).error == NumericError::None && value == 35 * 36 + 35,
+          "base 36 gave %d", value);
+}
+
+} // namespace
+
+int main()
+{
+    TestBoundaries();
+    TestRandomRoundTrip();
+    TestCorrectlyRoundedDigits();
+    TestParseMatchesStrtod();
+    TestParseFloatMatchesStrtof();
+    TestIntegerBase();
+
+    if (g_failures != 0) {
+        std::printf("NumericTextTest: %d failure(s)\n", g_failures);
+        return 1;
+    }
+    std::printf("NumericTextTest: all passed\n");
+    return 0;
+}